@@ -0,0 +1,57 @@
+#include "MarmotBenchmark.h"
+#include <fstream>
+#include <iostream>
+
+using namespace Marmot::Benchmark;
+
+/*
+ * Runs all registered MarmotMathCore benchmarks
+ *
+ * usage: MarmotMathCoreBenchmarks [--filter=<substring>] [--json=<file>] [--min_time=<seconds>]
+ */
+int main( int argc, char** argv )
+{
+  std::string filter;
+  std::string jsonFile;
+  double      minSeconds = 0.05;
+
+  for ( int i = 1; i < argc; i++ ) {
+    const std::string arg = argv[i];
+    if ( arg.rfind( "--filter=", 0 ) == 0 )
+      filter = arg.substr( 9 );
+    else if ( arg.rfind( "--json=", 0 ) == 0 )
+      jsonFile = arg.substr( 7 );
+    else if ( arg.rfind( "--min_time=", 0 ) == 0 )
+      minSeconds = std::stod( arg.substr( 11 ) );
+    else {
+      std::cout << "usage: " << argv[0] << " [--filter=<substring>] [--json=<file>] [--min_time=<seconds>]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector< Result > results;
+
+  std::cout << std::left << std::setw( 64 ) << "benchmark" << std::right << std::setw( 16 ) << "ns/iteration"
+            << std::setw( 16 ) << "items/s" << std::endl;
+
+  for ( const auto& benchmark : registry() ) {
+    if ( benchmark.name.find( filter ) == std::string::npos )
+      continue;
+
+    results.push_back( run( benchmark, minSeconds ) );
+    const Result& r = results.back();
+    std::cout << std::left << std::setw( 64 ) << r.name << std::right << std::setw( 16 ) << std::setprecision( 4 )
+              << r.nanosecondsPerIteration << std::setw( 16 ) << r.itemsPerSecond;
+    if ( r.allocationsPerIteration >= 0 )
+      std::cout << std::setw( 8 ) << r.allocationsPerIteration << " allocations";
+    std::cout << std::endl;
+  }
+
+  if ( !jsonFile.empty() ) {
+    std::ofstream out( jsonFile );
+    writeJSON( out, results );
+  }
+
+  return 0;
+}
@@ -0,0 +1,39 @@
+#include "Marmot/MarmotAutomaticDifferentiation.h"
+#include "MarmotBenchmark.h"
+
+using namespace Marmot;
+using namespace Marmot::AutomaticDifferentiation;
+using namespace Marmot::Benchmark;
+
+namespace {
+
+  // coupled nonlinear residual, generic in the scalar type
+  template < typename VectorType >
+  VectorType residual( const VectorType& X )
+  {
+    const auto n = X.size();
+    VectorType R( n );
+    for ( int i = 0; i < n; i++ )
+      R( i ) = X( i ) * X( ( i + 1 ) % n ) + 0.5 * exp( X( i ) );
+    return R;
+  }
+
+  const bool registered = []() {
+    for ( int n : { 6, 9, 13 } ) {
+      const Eigen::VectorXd X     = Eigen::VectorXd::LinSpaced( n, 0.1, 1.0 );
+      const VectorXdual     XDual = X.cast< dual >();
+
+      add(
+        "AutomaticDifferentiation/jacobian/" + std::to_string( n ),
+        [X]() { doNotOptimize( jacobian( residual< VectorXdual >, X ) ); },
+        n );
+
+      add(
+        "AutomaticDifferentiation/jacobian2nd/" + std::to_string( n ),
+        [XDual]() { doNotOptimize( jacobian2nd( residual< VectorXdual2nd >, XDual ) ); },
+        n );
+    }
+    return true;
+  }();
+
+} // namespace
@@ -0,0 +1,102 @@
+#include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotOrientationTable.h"
+#include "MarmotBenchmark.h"
+#include <cmath>
+
+using namespace Marmot;
+using namespace Marmot::Benchmark;
+
+namespace {
+
+  // elementwise kernels compared to std::exp
+  const int            nArray = 1 << 12;
+  const Eigen::ArrayXd x      = Eigen::ArrayXd::LinSpaced( nArray, -80, 80 );
+  Eigen::ArrayXd       y( nArray );
+
+  MARMOT_BENCHMARK(
+    "Math/std::exp/scalarLoop",
+    []() {
+      for ( int i = 0; i < nArray; i++ )
+        y( i ) = std::exp( x( i ) );
+      doNotOptimize( y );
+    },
+    nArray );
+
+  MARMOT_BENCHMARK(
+    "Math/exp/scalarLoop",
+    []() {
+      for ( int i = 0; i < nArray; i++ )
+        y( i ) = Math::exp( x( i ) );
+      doNotOptimize( y );
+    },
+    nArray );
+
+  MARMOT_BENCHMARK(
+    "Math/exp/array",
+    []() {
+      y = Math::exp( x );
+      doNotOptimize( y );
+    },
+    nArray );
+
+  MARMOT_BENCHMARK(
+    "Math/macauly/array",
+    []() {
+      y = Math::macauly( x );
+      doNotOptimize( y );
+    },
+    nArray );
+
+  MARMOT_BENCHMARK(
+    "Math/heaviside/array",
+    []() {
+      y = Math::heaviside( x );
+      doNotOptimize( y );
+    },
+    nArray );
+
+  // ODE helpers with a nonlinear rate of size 6
+  const Vector6d y0 = Vector6d::LinSpaced( 0.1, 1.0 );
+  auto           fRate( const Vector6d& y )
+  {
+    return Vector6d( -y.cwiseProduct( y.cwiseAbs() ) );
+  }
+
+  MARMOT_BENCHMARK( "Math/explicitEuler/6", []() { doNotOptimize( Math::explicitEuler( y0, 1e-3, fRate ) ); } );
+
+  MARMOT_BENCHMARK( "Math/semiImplicitEuler/6",
+                    []() { doNotOptimize( Math::semiImplicitEuler< 6 >( y0, 1e-3, fRate ) ); } );
+
+  MARMOT_BENCHMARK( "Math/explicitEulerRichardson/6",
+                    []() { doNotOptimize( Math::explicitEulerRichardson( y0, 1e-3, fRate ) ); } );
+
+  MARMOT_BENCHMARK( "Math/explicitEulerRichardsonWithErrorEstimator/6", []() {
+    doNotOptimize( Math::explicitEulerRichardsonWithErrorEstimator< 6 >( y0, 1e-3, 1e-6, fRate ) );
+  } );
+
+  MARMOT_BENCHMARK( "Math/centralDiff/6", []() { doNotOptimize( Math::centralDiff< 6, 6 >( fRate, y0 ) ); } );
+
+  // spectral decomposition and rotations
+  const Matrix3d stress = ( Matrix3d() << 1, 2, 3, 2, 5, 6, 3, 6, 9 ).finished();
+
+  MARMOT_BENCHMARK( "Math/eigenDecompositionSymmetric3x3",
+                    []() { doNotOptimize( Math::eigenDecompositionSymmetric3x3( stress ) ); } );
+
+  MARMOT_BENCHMARK( "Math/Eigen::SelfAdjointEigenSolver<Matrix3d>", []() {
+    doNotOptimize( Eigen::SelfAdjointEigenSolver< Matrix3d >( stress ).eigenvectors() );
+  } );
+
+  const Math::OrientationTable orientations = Math::OrientationTable::fromNormals(
+    Eigen::Matrix< double, 3, Eigen::Dynamic >::Random( 3, 21 ).colwise().normalized() );
+  Math::OrientationTable::Matrix6Xd localStresses;
+  const Vector6d                    globalStress = Vector6d::LinSpaced( 1, 6 );
+
+  MARMOT_BENCHMARK(
+    "Math/OrientationTable/rotateStressIn/21",
+    []() {
+      orientations.rotateStressIn( globalStress, localStresses );
+      doNotOptimize( localStresses );
+    },
+    21 );
+
+} // namespace
@@ -0,0 +1,69 @@
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include "MarmotBenchmark.h"
+
+using namespace Marmot;
+using namespace Marmot::NumericalAlgorithms::Differentiation;
+using namespace Marmot::Benchmark;
+
+namespace {
+
+  // coupled nonlinear residual, generic in the scalar type
+  template < typename VectorType >
+  VectorType residual( const VectorType& X )
+  {
+    const auto n = X.size();
+    VectorType R( n );
+    for ( int i = 0; i < n; i++ )
+      R( i ) = X( i ) * X( ( i + 1 ) % n ) + 0.5 * std::exp( X( i ) );
+    return R;
+  }
+
+  template < typename T >
+  T scalarFunction( const T x )
+  {
+    return x * x * std::exp( x );
+  }
+
+  MARMOT_BENCHMARK( "NumericalDifferentiation/forwardDifference/scalar",
+                    []() { doNotOptimize( forwardDifference( scalarFunction< double >, 2.5 ) ); } );
+
+  MARMOT_BENCHMARK( "NumericalDifferentiation/centralDifference/scalar",
+                    []() { doNotOptimize( centralDifference( scalarFunction< double >, 2.5 ) ); } );
+
+  MARMOT_BENCHMARK( "NumericalDifferentiation/Complex/forwardDifference/scalar",
+                    []() { doNotOptimize( Complex::forwardDifference( scalarFunction< complexDouble >, 2.5 ) ); } );
+
+  const bool registered = []() {
+    for ( int n : { 6, 9, 13 } ) {
+      const Eigen::VectorXd X = Eigen::VectorXd::LinSpaced( n, 0.1, 1.0 );
+      const std::string     N = "/" + std::to_string( n );
+
+      add(
+        "NumericalDifferentiation/forwardDifference" + N,
+        [X]() { doNotOptimize( forwardDifference( residual< Eigen::VectorXd >, X ) ); },
+        n );
+
+      add(
+        "NumericalDifferentiation/centralDifference" + N,
+        [X]() { doNotOptimize( centralDifference( residual< Eigen::VectorXd >, X ) ); },
+        n );
+
+      add(
+        "NumericalDifferentiation/Complex/forwardDifference" + N,
+        [X]() { doNotOptimize( Complex::forwardDifference( residual< Eigen::VectorXcd >, X ) ); },
+        n );
+
+      add(
+        "NumericalDifferentiation/Complex/centralDifference" + N,
+        [X]() { doNotOptimize( Complex::centralDifference( residual< Eigen::VectorXcd >, X ) ); },
+        n );
+
+      add(
+        "NumericalDifferentiation/Complex/fourthOrderAccurateDerivative" + N,
+        [X]() { doNotOptimize( Complex::fourthOrderAccurateDerivative( residual< Eigen::VectorXcd >, X ) ); },
+        n );
+    }
+    return true;
+  }();
+
+} // namespace
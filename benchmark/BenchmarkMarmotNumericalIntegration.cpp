@@ -0,0 +1,32 @@
+#include "Marmot/MarmotNumericalIntegration.h"
+#include "MarmotBenchmark.h"
+#include <cmath>
+
+using namespace Marmot::NumericalAlgorithms::Integration;
+using namespace Marmot::Benchmark;
+
+namespace {
+
+  const int nIntervals = 100;
+
+  double f( const double x )
+  {
+    return x * std::exp( -x );
+  }
+
+  MARMOT_BENCHMARK(
+    "NumericalIntegration/integrateScalarFunction/midpoint/100",
+    []() { doNotOptimize( integrateScalarFunction( f, { 0., 1. }, nIntervals, midpoint ) ); },
+    nIntervals );
+
+  MARMOT_BENCHMARK(
+    "NumericalIntegration/integrateScalarFunction/trapezodial/100",
+    []() { doNotOptimize( integrateScalarFunction( f, { 0., 1. }, nIntervals, trapezodial ) ); },
+    nIntervals );
+
+  MARMOT_BENCHMARK(
+    "NumericalIntegration/integrateScalarFunction/simpson/100",
+    []() { doNotOptimize( integrateScalarFunction( f, { 0., 1. }, nIntervals, simpson ) ); },
+    nIntervals );
+
+} // namespace
@@ -0,0 +1,72 @@
+#include "Marmot/MarmotBatch.h"
+#include "Marmot/MarmotTensor.h"
+#include "MarmotBenchmark.h"
+
+using namespace Marmot;
+using namespace Marmot::ContinuumMechanics;
+using namespace Marmot::Benchmark;
+
+namespace {
+
+  using Tensor33d = Eigen::TensorFixedSize< double, Eigen::Sizes< 3, 3 > >;
+
+  const Matrix3d stress = ( Matrix3d() << 1, 2, 3, 2, 5, 6, 3, 6, 9 ).finished();
+  const Vector3d a      = Vector3d( 1, 2, 3 );
+
+  // built on first use, as the CommonTensors of the library may not be initialized yet during static initialization
+  const EigenTensors::Tensor3333d& stiffness()
+  {
+    static const EigenTensors::Tensor3333d C = CommonTensors::Isym * 2. + CommonTensors::I2xI2;
+    return C;
+  }
+
+  const Eigen::array< Eigen::IndexPair< int >, 2 > doubleContraction = { Eigen::IndexPair< int >( 2, 0 ),
+                                                                         Eigen::IndexPair< int >( 3, 1 ) };
+
+  MARMOT_BENCHMARK( "Tensor/dyadicProduct", []() { doNotOptimize( TensorUtility::dyadicProduct( a, a ) ); } );
+
+  MARMOT_BENCHMARK( "Tensor/CommonTensors/dDeviatoricStress_dStress:stress", []() {
+    const Tensor33d s = CommonTensors::dDeviatoricStress_dStress.contract( TensorUtility::asTensor< 3, 3 >( stress ),
+                                                                            doubleContraction );
+    doNotOptimize( s );
+  } );
+
+  MARMOT_BENCHMARK( "Tensor/CommonTensors/Tensor3333d:Tensor3333d", []() {
+    const EigenTensors::Tensor3333d& C  = stiffness();
+    const EigenTensors::Tensor3333d  CC = C.contract( CommonTensors::dDeviatoricStress_dStress, doubleContraction );
+    doNotOptimize( CC );
+  } );
+
+  MARMOT_BENCHMARK( "Tensor/CommonTensors/Tensor3333d:Tensor3333d/asMatrix9d", []() {
+    const Matrix9d CC = TensorUtility::as< 9, 9 >( stiffness() ) *
+                        TensorUtility::as< 9, 9 >( CommonTensors::dDeviatoricStress_dStress );
+    doNotOptimize( CC );
+  } );
+
+  MARMOT_BENCHMARK( "Tensor/CommonTensors/LeviCivita3D.a", []() {
+    const Tensor33d e = CommonTensors::LeviCivita3D.contract( TensorUtility::asTensor< 3 >( a ),
+                                                              Eigen::array< Eigen::IndexPair< int >, 1 >{
+                                                                Eigen::IndexPair< int >( 2, 0 ) } );
+    doNotOptimize( e );
+  } );
+
+  // batched kernels, throughput per material point
+  constexpr int           nLanes   = 64;
+  BatchMatrix3d< nLanes > stresses = []() {
+    BatchMatrix3d< nLanes > A;
+    for ( int k = 0; k < nLanes; k++ )
+      A.set( k, stress * ( 1 + k ) );
+    return A;
+  }();
+
+  MARMOT_BENCHMARK(
+    "Tensor/Batched/J2/64",
+    []() { doNotOptimize( TensorUtility::J2( stresses ) ); },
+    nLanes );
+
+  MARMOT_BENCHMARK(
+    "Tensor/Batched/inverse/64",
+    []() { doNotOptimize( TensorUtility::inverse( stresses ) ); },
+    nLanes );
+
+} // namespace
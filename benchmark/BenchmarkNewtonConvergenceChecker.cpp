@@ -0,0 +1,17 @@
+#include "Marmot/NewtonConvergenceChecker.h"
+#include "MarmotBenchmark.h"
+
+using namespace Marmot::NumericalAlgorithms;
+using namespace Marmot::Benchmark;
+
+namespace {
+
+  const Eigen::VectorXd    residual = Eigen::VectorXd::Constant( 13, 1e-12 );
+  const Eigen::VectorXd    X        = Eigen::VectorXd::LinSpaced( 13, 0.1, 1.0 );
+  const Eigen::VectorXd    dX       = Eigen::VectorXd::Constant( 13, 1e-10 );
+  NewtonConvergenceChecker checker( Eigen::VectorXd::Ones( 13 ), 10, 15, 1e-10, 1e-10, 1e-8, 1e-8 );
+
+  MARMOT_BENCHMARK( "NewtonConvergenceChecker/isConverged/13",
+                    []() { doNotOptimize( checker.isConverged( residual, X, dX, 3 ) ); } );
+
+} // namespace
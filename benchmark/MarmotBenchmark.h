@@ -0,0 +1,217 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotAllocationTracking.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Minimal, dependency free microbenchmark harness for the MarmotMathCore kernels. Benchmarks are registered at static
+ * initialization time via \ref MARMOT_BENCHMARK and run by the benchmark executable, which reports the results on the
+ * console and optionally as JSON in the format of Google Benchmark, so that its tooling (e.g., compare.py) can be used
+ * to track regressions. In builds with MARMOT_ENABLE_ALLOCATION_TRACKING, the heap allocations per iteration are
+ * reported as well.
+ */
+namespace Marmot::Benchmark {
+
+  /**
+   * Prevent the compiler from optimizing away the computation of \ref value */
+  template < typename T >
+  inline void doNotOptimize( const T& value )
+  {
+#if defined( __GNUC__ ) || defined( __clang__ )
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+  }
+
+  struct Benchmark {
+    std::string                  name;
+    std::function< void( long ) > run;
+    double                       itemsPerIteration;
+  };
+
+  struct Result {
+    std::string name;
+    long        iterations;
+    double      nanosecondsPerIteration;
+    double      cpuNanosecondsPerIteration;
+    double      itemsPerSecond;
+    long        allocationsPerIteration;
+  };
+
+  inline std::vector< Benchmark >& registry()
+  {
+    static std::vector< Benchmark > benchmarks;
+    return benchmarks;
+  }
+
+  /**
+   * Register \ref kernel, which performs one iteration, under \ref name. \ref itemsPerIteration is used to report
+   * throughput, e.g., the number of function evaluations or array entries processed per iteration */
+  template < typename F >
+  bool add( const std::string& name, F kernel, double itemsPerIteration = 1.0 )
+  {
+    registry().push_back( { name,
+                            [kernel]( long nIterations ) mutable {
+                              for ( long i = 0; i < nIterations; i++ )
+                                kernel();
+                            },
+                            itemsPerIteration } );
+    return true;
+  }
+
+  /**
+   * Run a benchmark with automatically calibrated iteration count, and report the medians of the wall and the process
+   * CPU time of \ref repetitions runs with at least \ref minSeconds each */
+  inline Result run( const Benchmark& benchmark, double minSeconds = 0.05, int repetitions = 5 )
+  {
+    using clock = std::chrono::steady_clock;
+
+    // wall and CPU seconds
+    auto secondsFor = [&]( long nIterations ) {
+      const auto         start    = clock::now();
+      const std::clock_t cpuStart = std::clock();
+      benchmark.run( nIterations );
+      const std::clock_t cpuEnd = std::clock();
+      return std::make_pair( std::chrono::duration< double >( clock::now() - start ).count(),
+                             static_cast< double >( cpuEnd - cpuStart ) / CLOCKS_PER_SEC );
+    };
+
+    long   nIterations = 1;
+    double seconds     = secondsFor( nIterations ).first;
+    while ( seconds < minSeconds ) {
+      const double scale = seconds > 0 ? std::min( 10., 1.4 * minSeconds / seconds ) : 10.;
+      nIterations        = std::max( nIterations + 1, static_cast< long >( nIterations * scale ) );
+      seconds            = secondsFor( nIterations ).first;
+    }
+
+    std::vector< double > nanosecondsPerIteration( repetitions );
+    std::vector< double > cpuNanosecondsPerIteration( repetitions );
+    for ( int i = 0; i < repetitions; i++ ) {
+      const auto [wall, cpu]        = secondsFor( nIterations );
+      nanosecondsPerIteration[i]    = wall * 1e9 / nIterations;
+      cpuNanosecondsPerIteration[i] = cpu * 1e9 / nIterations;
+    }
+
+    std::sort( nanosecondsPerIteration.begin(), nanosecondsPerIteration.end() );
+    std::sort( cpuNanosecondsPerIteration.begin(), cpuNanosecondsPerIteration.end() );
+    const double median    = nanosecondsPerIteration[repetitions / 2];
+    const double cpuMedian = cpuNanosecondsPerIteration[repetitions / 2];
+
+#ifdef MARMOT_ENABLE_ALLOCATION_TRACKING
+    const long allocations = AllocationTracking::countAllocations( [&]() { benchmark.run( 1 ); } );
+#else
+    const long allocations = -1;
+#endif
+
+    return {
+      benchmark.name, nIterations, median, cpuMedian, benchmark.itemsPerIteration / median * 1e9, allocations };
+  }
+
+  /**
+   * Escape \ref text for use in a JSON string */
+  inline std::string escapeJSON( const std::string& text )
+  {
+    std::string escaped;
+    escaped.reserve( text.size() );
+    for ( const char ch : text ) {
+      switch ( ch ) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\b': escaped += "\\b"; break;
+      case '\f': escaped += "\\f"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\r': escaped += "\\r"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+        if ( static_cast< unsigned char >( ch ) < 0x20 ) {
+          char code[7];
+          std::snprintf( code, sizeof( code ), "\\u%04x", static_cast< unsigned char >( ch ) );
+          escaped += code;
+        }
+        else
+          escaped += ch;
+      }
+    }
+    return escaped;
+  }
+
+  inline void writeJSON( std::ostream& out, const std::vector< Result >& results )
+  {
+    const std::time_t now = std::time( nullptr );
+    char              date[32];
+    std::strftime( date, sizeof( date ), "%Y-%m-%dT%H:%M:%S", std::localtime( &now ) );
+
+    out << "{\n  \"context\": {\n    \"date\": \"" << date << "\",\n    \"library\": \"MarmotMathCore\",\n"
+        << "    \"library_build_type\": \"" <<
+#ifdef NDEBUG
+      "release"
+#else
+      "debug"
+#endif
+        << "\"\n  },\n  \"benchmarks\": [\n";
+
+    out << std::setprecision( 10 );
+    for ( size_t i = 0; i < results.size(); i++ ) {
+      const Result&     r    = results[i];
+      const std::string name = escapeJSON( r.name );
+      out << "    {\n      \"name\": \"" << name << "\",\n      \"run_name\": \"" << name
+          << "\",\n      \"run_type\": \"iteration\",\n      \"iterations\": " << r.iterations
+          << ",\n      \"real_time\": " << r.nanosecondsPerIteration
+          << ",\n      \"cpu_time\": " << r.cpuNanosecondsPerIteration
+          << ",\n      \"time_unit\": \"ns\",\n      \"items_per_second\": " << r.itemsPerSecond;
+      if ( r.allocationsPerIteration >= 0 )
+        out << ",\n      \"allocations_per_iteration\": " << r.allocationsPerIteration;
+      out << "\n    }"
+          << ( i + 1 < results.size() ? ",\n" : "\n" );
+    }
+    out << "  ]\n}\n";
+  }
+
+} // namespace Marmot::Benchmark
+
+#define MARMOT_BENCHMARK_CONCAT_( a, b ) a##b
+#define MARMOT_BENCHMARK_CONCAT( a, b ) MARMOT_BENCHMARK_CONCAT_( a, b )
+
+/**
+ * Register a benchmark at static initialization time, e.g.,
+ * MARMOT_BENCHMARK( "Math/exp", [&]() { doNotOptimize( Math::exp( x ) ); } ); */
+#define MARMOT_BENCHMARK( ... )                                                                                        \
+  static const bool MARMOT_BENCHMARK_CONCAT( marmotBenchmarkRegistered_, __LINE__ ) =                                  \
+    Marmot::Benchmark::add( __VA_ARGS__ )
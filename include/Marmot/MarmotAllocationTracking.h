@@ -0,0 +1,63 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+/**
+ * Heap allocation tracking for tests and benchmarks of allocation-free hot paths. If MARMOT_ENABLE_ALLOCATION_TRACKING
+ * is defined, test/MarmotAllocationTracking.cpp replaces the global operator new and, on glibc, malloc, calloc,
+ * realloc and the aligned variants (Eigen allocates through malloc), and counts all allocations per thread. With
+ * MARMOT_ENABLE_PROFILING, the allocations are also attributed to the active profiling scope.
+ *
+ * Not meant for production builds: the replacement is global for the whole program. Hence it is not part of the
+ * Marmot library, but the object library MarmotAllocationTracking linked only by the tests and benchmarks.
+ */
+
+#ifdef MARMOT_ENABLE_ALLOCATION_TRACKING
+
+#include <cstdint>
+#include <utility>
+
+namespace Marmot::AllocationTracking {
+
+  /**
+   * Number of heap allocations of the calling thread since its start */
+  std::uint64_t allocations();
+
+  /**
+   * Returns the number of heap allocations performed by the calling thread while calling \ref f */
+  template < typename F >
+  std::uint64_t countAllocations( F&& f )
+  {
+    const std::uint64_t before = allocations();
+    std::forward< F >( f )();
+    return allocations() - before;
+  }
+
+} // namespace Marmot::AllocationTracking
+
+#endif
@@ -0,0 +1,157 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace Marmot {
+
+  /**
+   * Bump pointer allocator for dynamic size temporaries. Memory is drawn from large blocks, which are kept for reuse
+   * after \ref reset or the end of a \ref Scope, so that, after warm-up, a material point evaluation does not call the
+   * global allocator at all. Eigen objects cannot use custom allocators, hence the memory is handed out as
+   * (aligned) Eigen::Map views; results of Marmot routines can be written into these views via their Eigen::Ref
+   * output arguments.
+   *
+   * An Arena is not synchronized: use \ref threadLocal (one arena per thread) or one arena per task.
+   *
+   * Example:
+   *   Arena::Scope scope;                                   // rewinds the thread's arena at the end of the block
+   *   auto J = Arena::threadLocal().matrix< double >( n, n );
+   *   centralDifference< double >( F, X, J, workspace );
+   */
+  class Arena {
+
+  public:
+    static constexpr std::size_t alignment = EIGEN_MAX_ALIGN_BYTES > 0 ? EIGEN_MAX_ALIGN_BYTES : 16;
+
+    template < typename Scalar >
+    using VectorMap = Eigen::Map< VectorXt< Scalar >, Eigen::AlignedMax >;
+    template < typename Scalar >
+    using MatrixMap = Eigen::Map< MatrixXt< Scalar >, Eigen::AlignedMax >;
+
+    /**
+     * Position in the arena, see \ref mark and \ref rewind */
+    struct Marker {
+      std::size_t block;
+      std::size_t offset;
+    };
+
+    /**
+     * Rewinds an arena, by default the calling thread's one, to its state at construction of the scope */
+    class Scope {
+
+    public:
+      explicit Scope( Arena& arena = Arena::threadLocal() ) : arena( arena ), marker( arena.mark() ) {}
+      ~Scope() { arena.rewind( marker ); }
+
+      Scope( const Scope& )            = delete;
+      Scope& operator=( const Scope& ) = delete;
+
+    private:
+      Arena&       arena;
+      const Marker marker;
+    };
+
+    explicit Arena( std::size_t blockSize = std::size_t( 1 ) << 20 );
+
+    Arena( const Arena& )            = delete;
+    Arena& operator=( const Arena& ) = delete;
+
+    /**
+     * The arena of the calling thread */
+    static Arena& threadLocal();
+
+    /**
+     * Uninitialized memory of \ref bytes bytes, aligned to \ref alignment */
+    void* allocate( std::size_t bytes );
+
+    /**
+     * Vector of \ref size default initialized entries */
+    template < typename Scalar >
+    VectorMap< Scalar > vector( Eigen::Index size )
+    {
+      return VectorMap< Scalar >( construct< Scalar >( size ), size );
+    }
+
+    /**
+     * Matrix of \ref rows x \ref cols default initialized entries */
+    template < typename Scalar >
+    MatrixMap< Scalar > matrix( Eigen::Index rows, Eigen::Index cols )
+    {
+      return MatrixMap< Scalar >( construct< Scalar >( rows * cols ), rows, cols );
+    }
+
+    Marker mark() const { return { current, offset }; }
+
+    /**
+     * Releases everything allocated after \ref marker was taken; the blocks are kept */
+    void rewind( const Marker& marker );
+
+    /**
+     * Releases all allocations; the blocks are kept */
+    void reset() { rewind( { 0, 0 } ); }
+
+    /**
+     * Total size of the blocks */
+    std::size_t capacity() const;
+
+  private:
+    struct BlockDeleter {
+      void operator()( std::byte* memory ) const { ::operator delete[]( memory, std::align_val_t( alignment ) ); }
+    };
+
+    struct Block {
+      std::unique_ptr< std::byte[], BlockDeleter > memory;
+      std::size_t                                  size;
+    };
+
+    template < typename Scalar >
+    Scalar* construct( Eigen::Index size )
+    {
+      // memory is released without calling destructors
+      static_assert( std::is_trivially_destructible< Scalar >::value, "arena memory requires trivial destructors" );
+
+      Scalar* data = static_cast< Scalar* >( allocate( sizeof( Scalar ) * size ) );
+      if constexpr ( !std::is_trivially_default_constructible< Scalar >::value )
+        for ( Eigen::Index i = 0; i < size; i++ )
+          new ( data + i ) Scalar;
+      return data;
+    }
+
+    const std::size_t    blockSize;
+    std::vector< Block > blocks;
+    std::size_t          current;
+    std::size_t          offset;
+  };
+
+} // namespace Marmot
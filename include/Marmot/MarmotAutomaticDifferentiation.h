@@ -26,7 +26,9 @@
  */
 
 #pragma once
+#include "Marmot/MarmotProfiling.h"
 #include "Marmot/MarmotTensor.h"
+#include "Marmot/MarmotWorkspace.h"
 #include "autodiff/forward/dual.hpp"
 #include "autodiff/forward/dual/eigen.hpp"
 #include <autodiff/forward/dual/dual.hpp>
@@ -78,7 +80,7 @@ namespace Marmot {
       const double*   in_point  = &valnode< order >( in );
       double*         out_point = &valnode< order + 1 >( out );
 
-      for ( size_t i = 0; i < size_t( std::pow( 2, order ) ); i++ ) {
+      for ( size_t i = 0; i < ( size_t( 1 ) << order ); i++ ) {
         *( out_point + i ) = *( in_point + i );
       }
 
@@ -95,8 +97,8 @@ namespace Marmot {
       double*         in_point  = &valnode< order >( in );
       double*         out_point = &valnode< order - 1 >( out );
 
-      for ( size_t i = 0; i < size_t( std::pow( 2, order - 1 ) ); i++ ) {
-        *( out_point + i ) = *( in_point + i + size_t( std::pow( 2, order - 1 ) ) );
+      for ( size_t i = 0; i < ( size_t( 1 ) << ( order - 1 ) ); i++ ) {
+        *( out_point + i ) = *( in_point + i + ( size_t( 1 ) << ( order - 1 ) ) );
       }
 
       return out;
@@ -138,9 +140,94 @@ namespace Marmot {
     using vector_to_vector_function_type_dual = std::function< VectorXdual( const VectorXdual& X ) >;
     std::pair< VectorXd, MatrixXd > jacobian( const vector_to_vector_function_type_dual& F, const VectorXd& X );
 
+    /**
+     * Version writing the values \ref F_ and the Jacobian \ref J, both sized according to \ref X, using the scratch
+     * memory of the calling thread's \ref workspace */
+    void jacobian( const vector_to_vector_function_type_dual& F,
+                   const VectorXd&                            X,
+                   Eigen::Ref< VectorXd >                     F_,
+                   Eigen::Ref< MatrixXd >                     J,
+                   Workspace&                                 workspace );
+
+    /**
+     * Fixed size version for a generic callable \ref F accepting Eigen::Matrix< dual, nCols, 1 >, e.g., jacobian< 6 >(
+     * F, X ) for a Vector6d \ref X; no type erasure and no heap allocations */
+    template < int nRows, typename functionType, int nCols >
+    std::pair< Eigen::Matrix< double, nRows, 1 >, Eigen::Matrix< double, nRows, nCols > > jacobian(
+      const functionType&                      F,
+      const Eigen::Matrix< double, nCols, 1 >& X )
+    {
+      static_assert( nRows > 0 && nCols > 0, "use the dynamic size version for dynamic sizes" );
+
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::jacobian" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( nCols );
+
+      Eigen::Matrix< dual, nCols, 1 >       X_ = X.template cast< dual >();
+      Eigen::Matrix< double, nRows, 1 >     F_;
+      Eigen::Matrix< double, nRows, nCols > J;
+
+      // J_ij = d F_i / d x_j
+      for ( int j = 0; j < nCols; j++ ) {
+        seed< 1 >( X_( j ), 1.0 );
+        const Eigen::Matrix< dual, nRows, 1 > F_right = F( X_ );
+        seed< 1 >( X_( j ), 0.0 );
+
+        for ( int i = 0; i < nRows; i++ )
+          J( i, j ) = derivative< 1 >( F_right( i ) );
+
+        if ( j == 0 )
+          for ( int i = 0; i < nRows; i++ )
+            F_( i ) = F_right( i ).val;
+      }
+
+      return { F_, J };
+    }
+
+    /**
+     * Jacobian-vector product J v, i.e., the directional derivative of \ref F at \ref X along \ref v, by seeding all
+     * dual numbers of X along \ref v; returns F( X ) and J v at the cost of a single evaluation of \ref F */
+    std::pair< VectorXd, VectorXd > jvp( const vector_to_vector_function_type_dual& F,
+                                         const VectorXd&                            X,
+                                         const VectorXd&                            v );
+
+    /**
+     * Fixed size version for a generic callable \ref F accepting Eigen::Matrix< dual, nCols, 1 >, e.g., jvp< 6 >( F, X,
+     * v ) for a Vector6d \ref X */
+    template < int nRows, typename functionType, int nCols >
+    std::pair< Eigen::Matrix< double, nRows, 1 >, Eigen::Matrix< double, nRows, 1 > > jvp(
+      const functionType&                      F,
+      const Eigen::Matrix< double, nCols, 1 >& X,
+      const Eigen::Matrix< double, nCols, 1 >& v )
+    {
+      static_assert( nRows > 0 && nCols > 0, "use the dynamic size version for dynamic sizes" );
+
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::jvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+      Eigen::Matrix< dual, nCols, 1 > X_ = X.template cast< dual >();
+      for ( int j = 0; j < nCols; j++ )
+        seed< 1 >( X_( j ), v( j ) );
+
+      const Eigen::Matrix< dual, nRows, 1 > F_ = F( X_ );
+      Eigen::Matrix< double, nRows, 1 >     FX;
+      Eigen::Matrix< double, nRows, 1 >     Jv;
+      for ( int i = 0; i < nRows; i++ ) {
+        FX( i ) = F_( i ).val;
+        Jv( i ) = derivative< 1 >( F_( i ) );
+      }
+
+      return { FX, Jv };
+    }
+
     using vector_to_vector_function_type_dual2nd = std::function< VectorXdual2nd( const VectorXdual2nd& X ) >;
     std::pair< VectorXdual, MatrixXdual > jacobian2nd( const vector_to_vector_function_type_dual2nd& F,
                                                        const VectorXdual&                            X );
+
+    void jacobian2nd( const vector_to_vector_function_type_dual2nd& F,
+                      const VectorXdual&                            X,
+                      Eigen::Ref< VectorXdual >                     F_,
+                      Eigen::Ref< MatrixXdual >                     J,
+                      Workspace&                                    workspace );
   } // namespace AutomaticDifferentiation
 
 } // namespace Marmot
@@ -0,0 +1,197 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+
+namespace Marmot {
+
+  /**
+   * Structure-of-arrays container for \ref K objects of the fixed size Eigen type \ref T, e.g., Batch< Matrix3d, 16 >
+   * for the stress tensors of 16 material points. Each coefficient of \ref T is stored as a contiguous column of \ref K
+   * lanes, so that coefficient-wise arithmetic on the lanes is vectorized by Eigen's packet math (SSE/AVX/AVX-512
+   * depending on the compile flags), with a scalar fallback if vectorization is disabled. \ref K may be
+   * Eigen::Dynamic for batch sizes known only at runtime.
+   */
+  template < typename T, int K >
+  class Batch {
+
+  public:
+    using Scalar                   = typename T::Scalar;
+    static constexpr int Rows      = T::RowsAtCompileTime;
+    static constexpr int Cols      = T::ColsAtCompileTime;
+    static constexpr int Size      = Rows * Cols;
+    static constexpr int BatchSize = K;
+
+    using Lanes   = Eigen::Array< Scalar, K, 1 >;
+    using Storage = Eigen::Array< Scalar, K, Size >;
+
+    static_assert( Rows > 0 && Cols > 0, "Batch requires a fixed size Eigen type" );
+
+    /// coefficient ( i + j * Rows ) of all lanes is stored in column ( i + j * Rows )
+    Storage data;
+
+    Batch() = default;
+
+    explicit Batch( Eigen::Index nLanes ) : data( nLanes, Size ) {}
+
+    Eigen::Index lanes() const { return data.rows(); }
+
+    /**
+     * All lanes of coefficient ( \ref i, \ref j ) */
+    auto operator()( int i, int j ) { return data.col( i + j * Rows ); }
+    auto operator()( int i, int j ) const { return data.col( i + j * Rows ); }
+
+    /**
+     * All lanes of coefficient \ref i of a vector type */
+    auto operator()( int i ) { return data.col( i ); }
+    auto operator()( int i ) const { return data.col( i ); }
+
+    /**
+     * Gather the object stored in lane \ref k */
+    T get( Eigen::Index k ) const
+    {
+      T out;
+      Eigen::Map< Eigen::Matrix< Scalar, Size, 1 > >( out.data() ) = data.row( k ).transpose();
+      return out;
+    }
+
+    /**
+     * Scatter \ref value into lane \ref k */
+    void set( Eigen::Index k, const T& value )
+    {
+      data.row( k ) = Eigen::Map< const Eigen::Matrix< Scalar, 1, Size > >( value.data() );
+    }
+
+    void setZero() { data.setZero(); }
+  };
+
+  template < int K >
+  using BatchVector3d = Batch< Vector3d, K >;
+
+  template < int K >
+  using BatchVector6d = Batch< Vector6d, K >;
+
+  template < int K >
+  using BatchMatrix3d = Batch< Matrix3d, K >;
+
+  namespace ContinuumMechanics::TensorUtility {
+
+    /**
+     * Lane-wise dyadic product \f$ a_i\, b_j \f$ */
+    template < int K >
+    BatchMatrix3d< K > dyadicProduct( const BatchVector3d< K >& a, const BatchVector3d< K >& b )
+    {
+      BatchMatrix3d< K > out( a.lanes() );
+      for ( int j = 0; j < 3; j++ )
+        for ( int i = 0; i < 3; i++ )
+          out( i, j ) = a( i ) * b( j );
+      return out;
+    }
+
+    /**
+     * Lane-wise trace \f$ A_{ii} \f$ */
+    template < int K >
+    typename BatchMatrix3d< K >::Lanes trace( const BatchMatrix3d< K >& A )
+    {
+      return A( 0, 0 ) + A( 1, 1 ) + A( 2, 2 );
+    }
+
+    /**
+     * Lane-wise deviatoric part \f$ A_{ij} - \frac{1}{3} A_{kk} \delta_{ij} \f$ */
+    template < int K >
+    BatchMatrix3d< K > deviatoric( const BatchMatrix3d< K >& A )
+    {
+      BatchMatrix3d< K >                       out = A;
+      const typename BatchMatrix3d< K >::Lanes p   = trace( A ) / 3.;
+      for ( int i = 0; i < 3; i++ )
+        out( i, i ) -= p;
+      return out;
+    }
+
+    /**
+     * Lane-wise determinant */
+    template < int K >
+    typename BatchMatrix3d< K >::Lanes determinant( const BatchMatrix3d< K >& A )
+    {
+      // clang-format off
+      return A( 0, 0 ) * ( A( 1, 1 ) * A( 2, 2 ) - A( 1, 2 ) * A( 2, 1 ) )
+           - A( 0, 1 ) * ( A( 1, 0 ) * A( 2, 2 ) - A( 1, 2 ) * A( 2, 0 ) )
+           + A( 0, 2 ) * ( A( 1, 0 ) * A( 2, 1 ) - A( 1, 1 ) * A( 2, 0 ) );
+      // clang-format on
+    }
+
+    /**
+     * Lane-wise inverse using the adjugate; no check for singular lanes is performed */
+    template < int K >
+    BatchMatrix3d< K > inverse( const BatchMatrix3d< K >& A )
+    {
+      BatchMatrix3d< K >                       out( A.lanes() );
+      const typename BatchMatrix3d< K >::Lanes invDet = determinant( A ).inverse();
+
+      out( 0, 0 ) = ( A( 1, 1 ) * A( 2, 2 ) - A( 1, 2 ) * A( 2, 1 ) ) * invDet;
+      out( 0, 1 ) = ( A( 0, 2 ) * A( 2, 1 ) - A( 0, 1 ) * A( 2, 2 ) ) * invDet;
+      out( 0, 2 ) = ( A( 0, 1 ) * A( 1, 2 ) - A( 0, 2 ) * A( 1, 1 ) ) * invDet;
+      out( 1, 0 ) = ( A( 1, 2 ) * A( 2, 0 ) - A( 1, 0 ) * A( 2, 2 ) ) * invDet;
+      out( 1, 1 ) = ( A( 0, 0 ) * A( 2, 2 ) - A( 0, 2 ) * A( 2, 0 ) ) * invDet;
+      out( 1, 2 ) = ( A( 0, 2 ) * A( 1, 0 ) - A( 0, 0 ) * A( 1, 2 ) ) * invDet;
+      out( 2, 0 ) = ( A( 1, 0 ) * A( 2, 1 ) - A( 1, 1 ) * A( 2, 0 ) ) * invDet;
+      out( 2, 1 ) = ( A( 0, 1 ) * A( 2, 0 ) - A( 0, 0 ) * A( 2, 1 ) ) * invDet;
+      out( 2, 2 ) = ( A( 0, 0 ) * A( 1, 1 ) - A( 0, 1 ) * A( 1, 0 ) ) * invDet;
+
+      return out;
+    }
+
+    /**
+     * Lane-wise first invariant \f$ I_1 = A_{ii} \f$ */
+    template < int K >
+    typename BatchMatrix3d< K >::Lanes I1( const BatchMatrix3d< K >& A )
+    {
+      return trace( A );
+    }
+
+    /**
+     * Lane-wise second invariant of the deviator \f$ J_2 = \frac{1}{2} s_{ij} s_{ji} \f$ */
+    template < int K >
+    typename BatchMatrix3d< K >::Lanes J2( const BatchMatrix3d< K >& A )
+    {
+      const BatchMatrix3d< K >           s   = deviatoric( A );
+      typename BatchMatrix3d< K >::Lanes out = 0.5 * ( s( 0, 0 ).square() + s( 1, 1 ).square() + s( 2, 2 ).square() );
+      out += s( 0, 1 ) * s( 1, 0 ) + s( 0, 2 ) * s( 2, 0 ) + s( 1, 2 ) * s( 2, 1 );
+      return out;
+    }
+
+    /**
+     * Lane-wise third invariant of the deviator \f$ J_3 = \det s_{ij} \f$ */
+    template < int K >
+    typename BatchMatrix3d< K >::Lanes J3( const BatchMatrix3d< K >& A )
+    {
+      return determinant( deviatoric( A ) );
+    }
+
+  } // namespace ContinuumMechanics::TensorUtility
+} // namespace Marmot
@@ -28,27 +28,63 @@
 
 #pragma once
 #include <cmath>
+#include <limits>
 
 namespace Marmot {
   namespace Constants {
     constexpr double Pi         = 3.141592653589793238463;
     constexpr double numZeroPos = 1e-16;
-    inline double    cubicRootEps()
+
+    /**
+     * \ref n-th root of \ref x in (0, 1] by Newton's method, for constant expressions. Starting from 1, the iterates
+     * decrease monotonically towards the root, hence the iteration stops as soon as they do not decrease anymore */
+    template < typename T >
+    constexpr T nthRoot( const T x, const int n )
+    {
+      T y = 1;
+      while ( true ) {
+        T yPowNMinus1 = 1;
+        for ( int i = 0; i < n - 1; i++ )
+          yPowNMinus1 *= y;
+
+        const T next = ( ( n - 1 ) * y + x / yPowNMinus1 ) / n;
+        if ( !( next < y ) )
+          return y;
+        y = next;
+      }
+    }
+
+    /**
+     * Square root of the machine epsilon of \ref T, e.g., the relative step size of forward differences; computed at
+     * compile time in long double to be correctly rounded for float and double */
+    template < typename T >
+    constexpr T sqrtEps = static_cast< T >( nthRoot< long double >( std::numeric_limits< T >::epsilon(), 2 ) );
+
+    /**
+     * Cubic root of the machine epsilon of \ref T, e.g., the relative step size of central differences; computed at
+     * compile time in long double to be correctly rounded for float and double */
+    template < typename T >
+    constexpr T cbrtEps = static_cast< T >( nthRoot< long double >( std::numeric_limits< T >::epsilon(), 3 ) );
+
+    template < typename T = double >
+    constexpr T cubicRootEps()
     {
-      return std::pow( std::numeric_limits< double >::epsilon(), 1. / 3 );
+      return cbrtEps< T >;
     }
-    inline double squareRootEps()
+
+    template < typename T = double >
+    constexpr T squareRootEps()
     {
-      return std::pow( std::numeric_limits< double >::epsilon(), 0.5 );
+      return sqrtEps< T >;
     }
 
-    const inline double SquareRootEps = squareRootEps();
-    const inline double CubicRootEps  = cubicRootEps();
-    constexpr double    sqrt3_8       = 0.61237243569579452454932101867647;
-    constexpr double    sqrt2_3       = 0.8164965809277260327324280249019;
-    constexpr double    sqrt3_2       = 1.2247448713915890490986420373529;
-    constexpr double    sqrt2         = 1.4142135623730950488016887242097;
-    constexpr double    sqrt3         = 1.7320508075688772935274463415059;
-    constexpr double    sqrt6         = 2.4494897427831780981972840747059;
+    constexpr double SquareRootEps = sqrtEps< double >;
+    constexpr double CubicRootEps  = cbrtEps< double >;
+    constexpr double sqrt3_8       = 0.61237243569579452454932101867647;
+    constexpr double sqrt2_3       = 0.8164965809277260327324280249019;
+    constexpr double sqrt3_2       = 1.2247448713915890490986420373529;
+    constexpr double sqrt2         = 1.4142135623730950488016887242097;
+    constexpr double sqrt3         = 1.7320508075688772935274463415059;
+    constexpr double sqrt6         = 2.4494897427831780981972840747059;
   } // namespace Constants
 } // namespace Marmot
@@ -0,0 +1,498 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotBatch.h"
+#include "Marmot/MarmotTypedefs.h"
+#include <array>
+#include <cmath>
+
+/**
+ * Requests the complete unrolling of the following loop with compile time bounds */
+#if defined( __clang__ )
+#define MARMOT_UNROLL _Pragma( "unroll" )
+#elif defined( __GNUC__ )
+#define MARMOT_UNROLL _Pragma( "GCC unroll 16" )
+#else
+#define MARMOT_UNROLL
+#endif
+
+namespace Marmot {
+  namespace NumericalAlgorithms::DenseSolvers {
+
+    /**
+     * Unrolled in place kernels shared by the scalar and the lane-wise (Batch) factorizations: A( i, j ) is either a
+     * scalar or all lanes of coefficient ( i, j ), and the rows of the right hand sides are accessed by \ref row. All
+     * loop bounds are compile time constants */
+    namespace Unrolled {
+
+      template < typename T, int N, int M >
+      EIGEN_STRONG_INLINE auto row( Eigen::Matrix< T, N, M >& B, int i )
+      {
+        return B.row( i );
+      }
+
+      template < typename T, int K >
+      EIGEN_STRONG_INLINE auto row( Batch< T, K >& B, int i )
+      {
+        return B( i );
+      }
+
+      /**
+       * \f$ A = L L^T \f$, overwriting the lower triangle of \ref A with \f$ L \f$ */
+      template < int N, typename T, typename MatrixType, typename VectorType >
+      EIGEN_STRONG_INLINE void cholesky( MatrixType& A, VectorType& invDiagonal )
+      {
+        using std::sqrt;
+        for ( int j = 0; j < N; j++ ) {
+          MARMOT_UNROLL
+          for ( int k = 0; k < j; k++ )
+            A( j, j ) -= A( j, k ) * A( j, k );
+          A( j, j )        = sqrt( A( j, j ) );
+          invDiagonal( j ) = T( 1 ) / A( j, j );
+
+          MARMOT_UNROLL
+          for ( int k = 0; k < j; k++ )
+            MARMOT_UNROLL
+            for ( int i = j + 1; i < N; i++ )
+              A( i, j ) -= A( i, k ) * A( j, k );
+          MARMOT_UNROLL
+          for ( int i = j + 1; i < N; i++ )
+            A( i, j ) *= invDiagonal( j );
+        }
+      }
+
+      /**
+       * \f$ A = L D L^T \f$ without pivoting, overwriting the strict lower triangle of \ref A with the unit lower
+       * triangular \f$ L \f$ and its diagonal with \f$ D \f$ */
+      template < int N, typename T, typename MatrixType, typename VectorType >
+      EIGEN_STRONG_INLINE void ldlt( MatrixType& A, VectorType& invDiagonal )
+      {
+        for ( int j = 0; j < N; j++ ) {
+          MARMOT_UNROLL
+          for ( int k = 0; k < j; k++ )
+            A( j, j ) -= A( j, k ) * A( j, k ) * A( k, k );
+          invDiagonal( j ) = T( 1 ) / A( j, j );
+
+          MARMOT_UNROLL
+          for ( int k = 0; k < j; k++ )
+            MARMOT_UNROLL
+            for ( int i = j + 1; i < N; i++ )
+              A( i, j ) -= A( i, k ) * A( j, k ) * A( k, k );
+          MARMOT_UNROLL
+          for ( int i = j + 1; i < N; i++ )
+            A( i, j ) *= invDiagonal( j );
+        }
+      }
+
+      /**
+       * Elimination of column \ref k below the (already pivoted) diagonal for the LU decomposition */
+      template < int N, typename T, typename MatrixType, typename VectorType >
+      EIGEN_STRONG_INLINE void eliminateColumn( MatrixType& A, VectorType& invDiagonal, const int k )
+      {
+        invDiagonal( k ) = T( 1 ) / A( k, k );
+        MARMOT_UNROLL
+        for ( int i = k + 1; i < N; i++ )
+          A( i, k ) *= invDiagonal( k );
+
+        // column by column for contiguous access in column major storage
+        MARMOT_UNROLL
+        for ( int j = k + 1; j < N; j++ )
+          MARMOT_UNROLL
+          for ( int i = k + 1; i < N; i++ )
+            A( i, j ) -= A( i, k ) * A( k, j );
+      }
+
+      /**
+       * Solves \f$ L X = B \f$ in place for the lower triangle of \ref L */
+      template < int N, bool unitDiagonal, typename MatrixType, typename VectorType, typename RhsType >
+      EIGEN_STRONG_INLINE void forwardSubstitution( const MatrixType& L, const VectorType& invDiagonal, RhsType& B )
+      {
+        MARMOT_UNROLL
+        for ( int i = 0; i < N; i++ ) {
+          MARMOT_UNROLL
+          for ( int k = 0; k < i; k++ )
+            row( B, i ) -= L( i, k ) * row( B, k );
+          if constexpr ( !unitDiagonal )
+            row( B, i ) *= invDiagonal( i );
+        }
+      }
+
+      /**
+       * Solves \f$ L^T X = B \f$ in place for the lower triangle of \ref L */
+      template < int N, bool unitDiagonal, typename MatrixType, typename VectorType, typename RhsType >
+      EIGEN_STRONG_INLINE void backwardSubstitutionTransposed( const MatrixType& L,
+                                                               const VectorType& invDiagonal,
+                                                               RhsType&          B )
+      {
+        MARMOT_UNROLL
+        for ( int i = N - 1; i >= 0; i-- ) {
+          MARMOT_UNROLL
+          for ( int k = i + 1; k < N; k++ )
+            row( B, i ) -= L( k, i ) * row( B, k );
+          if constexpr ( !unitDiagonal )
+            row( B, i ) *= invDiagonal( i );
+        }
+      }
+
+      /**
+       * Solves \f$ U X = B \f$ in place for the upper triangle of \ref U */
+      template < int N, typename MatrixType, typename VectorType, typename RhsType >
+      EIGEN_STRONG_INLINE void backwardSubstitution( const MatrixType& U, const VectorType& invDiagonal, RhsType& B )
+      {
+        MARMOT_UNROLL
+        for ( int i = N - 1; i >= 0; i-- ) {
+          MARMOT_UNROLL
+          for ( int k = i + 1; k < N; k++ )
+            row( B, i ) -= U( i, k ) * row( B, k );
+          row( B, i ) *= invDiagonal( i );
+        }
+      }
+
+      template < int N, typename VectorType, typename RhsType >
+      EIGEN_STRONG_INLINE void scaleRows( const VectorType& factors, RhsType& B )
+      {
+        MARMOT_UNROLL
+        for ( int i = 0; i < N; i++ )
+          row( B, i ) *= factors( i );
+      }
+
+    } // namespace Unrolled
+
+    /**
+     * Fully unrolled LU decomposition with partial pivoting of a fixed size \ref N x \ref N matrix, e.g., of the
+     * Jacobian of a local Newton iteration. The factorization is kept and may be reused for any number of \ref solve
+     * calls, e.g., for the residual and for the consistent tangent operator */
+    template < int N, typename T = double >
+    class LU {
+
+    public:
+      using MatrixType = Eigen::Matrix< T, N, N >;
+      using VectorType = Eigen::Matrix< T, N, 1 >;
+
+      static_assert( N > 0, "the unrolled solvers require a fixed size" );
+
+      LU() = default;
+
+      explicit LU( const MatrixType& A ) { compute( A ); }
+
+      LU& compute( const MatrixType& A )
+      {
+        factors = A;
+        MARMOT_UNROLL
+        for ( int k = 0; k < N; k++ ) {
+          int pivot = k;
+          T   max   = std::abs( factors( k, k ) );
+          MARMOT_UNROLL
+          for ( int i = k + 1; i < N; i++ )
+            if ( std::abs( factors( i, k ) ) > max ) {
+              max   = std::abs( factors( i, k ) );
+              pivot = i;
+            }
+          transpositions[k] = pivot;
+          if ( pivot != k )
+            factors.row( k ).swap( factors.row( pivot ) );
+
+          Unrolled::eliminateColumn< N, T >( factors, invDiagonal, k );
+        }
+        return *this;
+      }
+
+      /**
+       * Solution \f$ X = A^{-1} B \f$ for one or several right hand sides \ref B */
+      template < typename Derived >
+      Eigen::Matrix< T, N, Derived::ColsAtCompileTime > solve( const Eigen::MatrixBase< Derived >& B ) const
+      {
+        Eigen::Matrix< T, N, Derived::ColsAtCompileTime > X = B;
+        for ( int k = 0; k < N; k++ )
+          if ( transpositions[k] != k )
+            X.row( k ).swap( X.row( transpositions[k] ) );
+        Unrolled::forwardSubstitution< N, true >( factors, invDiagonal, X );
+        Unrolled::backwardSubstitution< N >( factors, invDiagonal, X );
+        return X;
+      }
+
+      /**
+       * Eigen::NumericalIssue for a singular matrix */
+      Eigen::ComputationInfo info() const
+      {
+        return invDiagonal.allFinite() ? Eigen::Success : Eigen::NumericalIssue;
+      }
+
+      /**
+       * Unit lower triangular L and upper triangular U of \f$ P A = L U \f$ */
+      const MatrixType& matrixLU() const { return factors; }
+
+    private:
+      MatrixType            factors;
+      VectorType            invDiagonal;
+      std::array< int, N > transpositions;
+    };
+
+    /**
+     * Fully unrolled \f$ L D L^T \f$ decomposition without pivoting of a symmetric fixed size \ref N x \ref N matrix
+     * with nonzero pivots, e.g., a symmetric but indefinite Newton matrix; only the lower triangle of the matrix is
+     * read */
+    template < int N, typename T = double >
+    class LDLT {
+
+    public:
+      using MatrixType = Eigen::Matrix< T, N, N >;
+      using VectorType = Eigen::Matrix< T, N, 1 >;
+
+      static_assert( N > 0, "the unrolled solvers require a fixed size" );
+
+      LDLT() = default;
+
+      explicit LDLT( const MatrixType& A ) { compute( A ); }
+
+      LDLT& compute( const MatrixType& A )
+      {
+        factors = A;
+        Unrolled::ldlt< N, T >( factors, invDiagonal );
+        return *this;
+      }
+
+      template < typename Derived >
+      Eigen::Matrix< T, N, Derived::ColsAtCompileTime > solve( const Eigen::MatrixBase< Derived >& B ) const
+      {
+        Eigen::Matrix< T, N, Derived::ColsAtCompileTime > X = B;
+        Unrolled::forwardSubstitution< N, true >( factors, invDiagonal, X );
+        Unrolled::scaleRows< N >( invDiagonal, X );
+        Unrolled::backwardSubstitutionTransposed< N, true >( factors, invDiagonal, X );
+        return X;
+      }
+
+      /**
+       * Eigen::NumericalIssue for a zero pivot */
+      Eigen::ComputationInfo info() const
+      {
+        return invDiagonal.allFinite() ? Eigen::Success : Eigen::NumericalIssue;
+      }
+
+      VectorType vectorD() const { return factors.diagonal(); }
+
+    private:
+      MatrixType factors;
+      VectorType invDiagonal;
+    };
+
+    /**
+     * Fully unrolled Cholesky decomposition \f$ L L^T \f$ of a symmetric positive definite fixed size \ref N x \ref N
+     * matrix; only the lower triangle of the matrix is read */
+    template < int N, typename T = double >
+    class Cholesky {
+
+    public:
+      using MatrixType = Eigen::Matrix< T, N, N >;
+      using VectorType = Eigen::Matrix< T, N, 1 >;
+
+      static_assert( N > 0, "the unrolled solvers require a fixed size" );
+
+      Cholesky() = default;
+
+      explicit Cholesky( const MatrixType& A ) { compute( A ); }
+
+      Cholesky& compute( const MatrixType& A )
+      {
+        factors = A;
+        Unrolled::cholesky< N, T >( factors, invDiagonal );
+        return *this;
+      }
+
+      template < typename Derived >
+      Eigen::Matrix< T, N, Derived::ColsAtCompileTime > solve( const Eigen::MatrixBase< Derived >& B ) const
+      {
+        Eigen::Matrix< T, N, Derived::ColsAtCompileTime > X = B;
+        Unrolled::forwardSubstitution< N, false >( factors, invDiagonal, X );
+        Unrolled::backwardSubstitutionTransposed< N, false >( factors, invDiagonal, X );
+        return X;
+      }
+
+      /**
+       * Eigen::NumericalIssue if the matrix is not positive definite */
+      Eigen::ComputationInfo info() const
+      {
+        return ( invDiagonal.array() > 0 ).all() && invDiagonal.allFinite() ? Eigen::Success : Eigen::NumericalIssue;
+      }
+
+    private:
+      MatrixType factors;
+      VectorType invDiagonal;
+    };
+
+    /**
+     * Lane-wise LU decomposition with partial pivoting of \ref K independent \ref N x \ref N systems stored as
+     * structure of arrays, see \ref Batch. The elimination is vectorized across the lanes; only the row interchanges,
+     * which differ between lanes, are performed lane by lane */
+    template < int N, int K, typename T = double >
+    class BatchLU {
+
+    public:
+      using MatrixType = Batch< Eigen::Matrix< T, N, N >, K >;
+      using VectorType = Batch< Eigen::Matrix< T, N, 1 >, K >;
+
+      BatchLU() = default;
+
+      explicit BatchLU( const MatrixType& A ) { compute( A ); }
+
+      BatchLU& compute( const MatrixType& A )
+      {
+        factors     = A;
+        invDiagonal.data.resize( A.lanes(), N );
+        transpositions.resize( A.lanes(), N );
+
+        for ( int k = 0; k < N; k++ ) {
+          typename MatrixType::Lanes max   = factors( k, k ).abs();
+          Eigen::Array< int, K, 1 >  pivot = Eigen::Array< int, K, 1 >::Constant( A.lanes(), k );
+          for ( int i = k + 1; i < N; i++ ) {
+            const auto larger = factors( i, k ).abs() > max;
+            max               = larger.select( factors( i, k ).abs(), max );
+            pivot             = larger.select( i, pivot );
+          }
+          transpositions.col( k ) = pivot;
+
+          for ( Eigen::Index l = 0; l < A.lanes(); l++ )
+            if ( pivot( l ) != k )
+              for ( int j = 0; j < N; j++ )
+                std::swap( factors.data( l, k + j * N ), factors.data( l, pivot( l ) + j * N ) );
+
+          Unrolled::eliminateColumn< N, T >( factors, invDiagonal, k );
+        }
+        return *this;
+      }
+
+      VectorType solve( const VectorType& b ) const
+      {
+        VectorType x = b;
+        for ( Eigen::Index l = 0; l < x.lanes(); l++ )
+          for ( int k = 0; k < N; k++ )
+            std::swap( x.data( l, k ), x.data( l, transpositions( l, k ) ) );
+
+        Unrolled::forwardSubstitution< N, true >( factors, invDiagonal, x );
+        Unrolled::backwardSubstitution< N >( factors, invDiagonal, x );
+        return x;
+      }
+
+      /**
+       * Eigen::NumericalIssue if any lane is singular */
+      Eigen::ComputationInfo info() const
+      {
+        return invDiagonal.data.allFinite() ? Eigen::Success : Eigen::NumericalIssue;
+      }
+
+    private:
+      MatrixType                factors;
+      VectorType                invDiagonal;
+      Eigen::Array< int, K, N > transpositions;
+    };
+
+    /**
+     * Lane-wise \f$ L D L^T \f$ decomposition without pivoting of \ref K independent symmetric \ref N x \ref N
+     * systems, fully vectorized across the lanes */
+    template < int N, int K, typename T = double >
+    class BatchLDLT {
+
+    public:
+      using MatrixType = Batch< Eigen::Matrix< T, N, N >, K >;
+      using VectorType = Batch< Eigen::Matrix< T, N, 1 >, K >;
+
+      BatchLDLT() = default;
+
+      explicit BatchLDLT( const MatrixType& A ) { compute( A ); }
+
+      BatchLDLT& compute( const MatrixType& A )
+      {
+        factors     = A;
+        invDiagonal.data.resize( A.lanes(), N );
+        Unrolled::ldlt< N, T >( factors, invDiagonal );
+        return *this;
+      }
+
+      VectorType solve( const VectorType& b ) const
+      {
+        VectorType x = b;
+        Unrolled::forwardSubstitution< N, true >( factors, invDiagonal, x );
+        Unrolled::scaleRows< N >( invDiagonal, x );
+        Unrolled::backwardSubstitutionTransposed< N, true >( factors, invDiagonal, x );
+        return x;
+      }
+
+      Eigen::ComputationInfo info() const
+      {
+        return invDiagonal.data.allFinite() ? Eigen::Success : Eigen::NumericalIssue;
+      }
+
+    private:
+      MatrixType factors;
+      VectorType invDiagonal;
+    };
+
+    /**
+     * Lane-wise Cholesky decomposition of \ref K independent symmetric positive definite \ref N x \ref N systems,
+     * fully vectorized across the lanes */
+    template < int N, int K, typename T = double >
+    class BatchCholesky {
+
+    public:
+      using MatrixType = Batch< Eigen::Matrix< T, N, N >, K >;
+      using VectorType = Batch< Eigen::Matrix< T, N, 1 >, K >;
+
+      BatchCholesky() = default;
+
+      explicit BatchCholesky( const MatrixType& A ) { compute( A ); }
+
+      BatchCholesky& compute( const MatrixType& A )
+      {
+        factors     = A;
+        invDiagonal.data.resize( A.lanes(), N );
+        Unrolled::cholesky< N, T >( factors, invDiagonal );
+        return *this;
+      }
+
+      VectorType solve( const VectorType& b ) const
+      {
+        VectorType x = b;
+        Unrolled::forwardSubstitution< N, false >( factors, invDiagonal, x );
+        Unrolled::backwardSubstitutionTransposed< N, false >( factors, invDiagonal, x );
+        return x;
+      }
+
+      /**
+       * Eigen::NumericalIssue if any lane is not positive definite */
+      Eigen::ComputationInfo info() const
+      {
+        return ( invDiagonal.data > 0 ).all() && invDiagonal.data.allFinite() ? Eigen::Success : Eigen::NumericalIssue;
+      }
+
+    private:
+      MatrixType factors;
+      VectorType invDiagonal;
+    };
+
+  } // namespace NumericalAlgorithms::DenseSolvers
+} // namespace Marmot
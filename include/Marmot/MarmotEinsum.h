@@ -0,0 +1,415 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Marmot::ContinuumMechanics::TensorUtility::Einsum {
+
+  /**
+   * Index labels of an operand of \ref contract, e.g., Indices< 'i', 'j', 'k', 'l' > for \f$ A_{ijkl} \f$ */
+  template < char... labels >
+  struct Indices {
+    static constexpr int                                     rank  = sizeof...( labels );
+    static constexpr std::array< char, sizeof...( labels ) > chars = { labels... };
+  };
+
+  /**
+   * Compile-time constant Levi-Civita symbol \f$ \varepsilon_{ijk} \f$; as operand of \ref contract, the 21 zero
+   * entries are skipped and the remaining ones are applied by addition and subtraction */
+  struct LeviCivita3D {
+    using Scalar                                     = double;
+    static constexpr std::array< int, 3 > dimensions = { 3, 3, 3 };
+
+    static constexpr double entry( const std::array< int, 3 >& i )
+    {
+      return ( i[0] - i[1] ) * ( i[1] - i[2] ) * ( i[2] - i[0] ) / 2;
+    }
+  };
+
+  /**
+   * Compile-time constant Kronecker delta \f$ \delta_{ij} \f$ of dimension \ref n */
+  template < int n >
+  struct KroneckerDelta {
+    using Scalar                                     = double;
+    static constexpr std::array< int, 2 > dimensions = { n, n };
+
+    static constexpr double entry( const std::array< int, 2 >& i ) { return i[0] == i[1] ? 1 : 0; }
+  };
+
+  /**
+   * Scalar one, the second operand of a single operand contraction */
+  struct One {
+    using Scalar                                     = double;
+    static constexpr std::array< int, 0 > dimensions = {};
+
+    static constexpr double entry( const std::array< int, 0 >& ) { return 1; }
+  };
+
+  /**
+   * Compile-time shape of an operand: Eigen::TensorFixedSize, fixed size Eigen::Matrix (vectors have rank 1), maps of
+   * both, and compile-time constants providing a static constexpr entry() */
+  template < typename T, typename = void >
+  struct Operand;
+
+  template < typename T >
+  struct Operand< T, std::void_t< decltype( &T::entry ) > > {
+    using Scalar                     = typename T::Scalar;
+    static constexpr bool isConstant = true;
+    static constexpr auto dimensions = T::dimensions;
+  };
+
+  template < typename S, std::ptrdiff_t... dims, int options, typename IndexType >
+  struct Operand< Eigen::TensorFixedSize< S, Eigen::Sizes< dims... >, options, IndexType > > {
+    static_assert( !( options & Eigen::RowMajor ), "only column major tensors are supported" );
+    using Scalar                                                     = S;
+    static constexpr bool                                 isConstant = false;
+    static constexpr std::array< int, sizeof...( dims ) > dimensions = { static_cast< int >( dims )... };
+  };
+
+  template < int rows, int cols >
+  constexpr auto matrixDimensions()
+  {
+    if constexpr ( cols == 1 )
+      return std::array< int, 1 >{ rows };
+    else
+      return std::array< int, 2 >{ rows, cols };
+  }
+
+  template < typename S, int rows, int cols, int options, int maxRows, int maxCols >
+  struct Operand< Eigen::Matrix< S, rows, cols, options, maxRows, maxCols > > {
+    static_assert( rows > 0 && cols > 0, "only fixed size matrices are supported" );
+    static_assert( cols == 1 || !( options & Eigen::RowMajor ), "only column major matrices are supported" );
+    using Scalar                     = S;
+    static constexpr bool isConstant = false;
+    static constexpr auto dimensions = matrixDimensions< rows, cols >();
+  };
+
+  template < typename T, int options, template < class > class MakePointer >
+  struct Operand< Eigen::TensorMap< T, options, MakePointer > > : Operand< std::remove_const_t< T > > {
+  };
+
+  template < typename T, int options >
+  struct Operand< Eigen::Map< T, options, Eigen::Stride< 0, 0 > > > : Operand< std::remove_const_t< T > > {
+  };
+
+  /**
+   * Compile-time plan of the contraction \ref IA, \ref IB -> \ref IC of the operands \ref TA and \ref TB. The loop runs
+   * over all distinct labels; labels not part of \ref IC are summed over */
+  template < typename IA, typename IB, typename IC, typename TA, typename TB >
+  struct Contraction {
+
+    using OperandA = Operand< TA >;
+    using OperandB = Operand< TB >;
+
+    static_assert( IA::rank == OperandA::dimensions.size(), "number of labels does not match the rank of A" );
+    static_assert( IB::rank == OperandB::dimensions.size(), "number of labels does not match the rank of B" );
+    static_assert( OperandA::isConstant || OperandB::isConstant ||
+                     std::is_same_v< typename OperandA::Scalar, typename OperandB::Scalar >,
+                   "operands must share the scalar type" );
+
+    using Scalar = std::conditional_t< OperandA::isConstant, typename OperandB::Scalar, typename OperandA::Scalar >;
+
+    static constexpr int nAll = IC::rank + IA::rank + IB::rank;
+
+    /// all labels, output labels first
+    static constexpr std::array< char, nAll > allLabels()
+    {
+      std::array< char, nAll > out{};
+      int                      k = 0;
+      for ( int r = 0; r < IC::rank; r++ )
+        out[k++] = IC::chars[r];
+      for ( int r = 0; r < IA::rank; r++ )
+        out[k++] = IA::chars[r];
+      for ( int r = 0; r < IB::rank; r++ )
+        out[k++] = IB::chars[r];
+      return out;
+    }
+
+    template < size_t N >
+    static constexpr int find( const std::array< char, N >& chars, char c, int end = N )
+    {
+      for ( int k = 0; k < end; k++ )
+        if ( chars[k] == c )
+          return k;
+      return -1;
+    }
+
+    static constexpr int countLabels()
+    {
+      constexpr auto all = allLabels();
+      int            n   = 0;
+      for ( int k = 0; k < nAll; k++ )
+        n += find( all, all[k], k ) < 0;
+      return n;
+    }
+
+    static constexpr int nLabels = countLabels();
+
+    static constexpr std::array< char, nLabels > distinctLabels()
+    {
+      constexpr auto              all = allLabels();
+      std::array< char, nLabels > out{};
+      int                         n = 0;
+      for ( int k = 0; k < nAll; k++ )
+        if ( find( all, all[k], k ) < 0 )
+          out[n++] = all[k];
+      return out;
+    }
+
+    static constexpr std::array< char, nLabels > labels = distinctLabels();
+
+    /// extent of label \ref c, -1 if the operands disagree or the label does not appear in an operand
+    static constexpr int extent( char c )
+    {
+      int out = -1;
+      for ( int r = 0; r < IA::rank; r++ )
+        if ( IA::chars[r] == c ) {
+          if ( out >= 0 && out != OperandA::dimensions[r] )
+            return -1;
+          out = OperandA::dimensions[r];
+        }
+      for ( int r = 0; r < IB::rank; r++ )
+        if ( IB::chars[r] == c ) {
+          if ( out >= 0 && out != OperandB::dimensions[r] )
+            return -1;
+          out = OperandB::dimensions[r];
+        }
+      return out;
+    }
+
+    static constexpr bool isValid()
+    {
+      for ( int k = 0; k < nLabels; k++ )
+        if ( extent( labels[k] ) < 0 )
+          return false;
+      for ( int r = 0; r < IC::rank; r++ )
+        if ( find( IC::chars, IC::chars[r], r ) >= 0 )
+          return false;
+      return true;
+    }
+
+    static_assert( isValid(),
+                   "every output label must appear once in the output and in an operand, and the extents of a label "
+                   "must agree between the operands" );
+
+    static constexpr std::array< int, IC::rank > outputDimensions()
+    {
+      std::array< int, IC::rank > out{};
+      for ( int r = 0; r < IC::rank; r++ )
+        out[r] = extent( IC::chars[r] );
+      return out;
+    }
+
+    static constexpr std::array< int, IC::rank > dimensionsC = outputDimensions();
+
+    static constexpr int numberOfTerms()
+    {
+      int n = 1;
+      for ( int k = 0; k < nLabels; k++ )
+        n *= extent( labels[k] );
+      return n;
+    }
+
+    static constexpr int nTerms = numberOfTerms();
+
+    /// larger contractions are evaluated by a loop to bound the compile time
+    static constexpr int maxUnrolledTerms = 2048;
+
+    /**
+     * Evaluate all terms into the zero initialized output \ref c */
+    static void evaluate( Scalar* c, const TA& a, const TB& b )
+    {
+      if constexpr ( nTerms <= maxUnrolledTerms )
+        unrolled( c, a, b, std::make_index_sequence< nTerms >() );
+      else
+        looped( c, a, b );
+    }
+
+    /// value of label \ref l in term \ref n; the first label runs fastest
+    static constexpr int labelValue( int n, int l )
+    {
+      for ( int k = 0; k < l; k++ )
+        n /= extent( labels[k] );
+      return n % extent( labels[l] );
+    }
+
+    template < size_t R >
+    static constexpr std::array< int, R > indicesOf( int n, const std::array< char, R >& chars )
+    {
+      std::array< int, R > out{};
+      for ( size_t r = 0; r < R; r++ )
+        out[r] = labelValue( n, find( labels, chars[r] ) );
+      return out;
+    }
+
+    /// column major offset of term \ref n into an operand labeled \ref chars with dimensions \ref dims
+    template < size_t R >
+    static constexpr int offsetOf( int n, const std::array< char, R >& chars, const std::array< int, R >& dims )
+    {
+      const std::array< int, R > i      = indicesOf( n, chars );
+      int                        offset = 0;
+      int                        stride = 1;
+      for ( size_t r = 0; r < R; r++ ) {
+        offset += i[r] * stride;
+        stride *= dims[r];
+      }
+      return offset;
+    }
+
+    template < typename T, typename Indices >
+    static constexpr double constantEntry( int n )
+    {
+      if constexpr ( Operand< T >::isConstant )
+        return T::entry( indicesOf( n, Indices::chars ) );
+      else
+        return 0;
+    }
+
+    /**
+     * c += value * data for term \ref n, where value is the entry of the compile-time constant \ref TConstant */
+    template < int n, typename TConstant, typename IConstant, typename IOther, typename OperandOther >
+    static void accumulateScaled( Scalar& c, const Scalar* data )
+    {
+      constexpr double value  = constantEntry< TConstant, IConstant >( n );
+      constexpr int    offset = offsetOf( n, IOther::chars, OperandOther::dimensions );
+      if constexpr ( value == 1 )
+        c += data[offset];
+      else if constexpr ( value == -1 )
+        c -= data[offset];
+      else if constexpr ( value != 0 )
+        c += value * data[offset];
+    }
+
+    /**
+     * c += a * b for term \ref n; zero entries of compile-time constants are skipped and entries of +-1 are applied
+     * without multiplication */
+    template < int n >
+    static void accumulate( Scalar* c, const TA& a, const TB& b )
+    {
+      constexpr int offC = offsetOf( n, IC::chars, dimensionsC );
+
+      if constexpr ( OperandA::isConstant && OperandB::isConstant ) {
+        constexpr double value = constantEntry< TA, IA >( n ) * constantEntry< TB, IB >( n );
+        if constexpr ( value != 0 )
+          c[offC] += value;
+      }
+      else if constexpr ( OperandA::isConstant )
+        accumulateScaled< n, TA, IA, IB, OperandB >( c[offC], b.data() );
+      else if constexpr ( OperandB::isConstant )
+        accumulateScaled< n, TB, IB, IA, OperandA >( c[offC], a.data() );
+      else
+        c[offC] += a.data()[offsetOf( n, IA::chars, OperandA::dimensions )] *
+                   b.data()[offsetOf( n, IB::chars, OperandB::dimensions )];
+    }
+
+    /**
+     * Loop over the terms for contractions too large to be unrolled */
+    static void looped( Scalar* c, const TA& a, const TB& b )
+    {
+      for ( int n = 0; n < nTerms; n++ ) {
+        Scalar& cn = c[offsetOf( n, IC::chars, dimensionsC )];
+        if constexpr ( OperandA::isConstant && OperandB::isConstant )
+          cn += constantEntry< TA, IA >( n ) * constantEntry< TB, IB >( n );
+        else if constexpr ( OperandA::isConstant ) {
+          const double value = constantEntry< TA, IA >( n );
+          if ( value != 0 )
+            cn += value * b.data()[offsetOf( n, IB::chars, OperandB::dimensions )];
+        }
+        else if constexpr ( OperandB::isConstant ) {
+          const double value = constantEntry< TB, IB >( n );
+          if ( value != 0 )
+            cn += value * a.data()[offsetOf( n, IA::chars, OperandA::dimensions )];
+        }
+        else
+          cn += a.data()[offsetOf( n, IA::chars, OperandA::dimensions )] *
+                b.data()[offsetOf( n, IB::chars, OperandB::dimensions )];
+      }
+    }
+
+    template < size_t... n >
+    static void unrolled( Scalar* c, const TA& a, const TB& b, std::index_sequence< n... > )
+    {
+      ( accumulate< n >( c, a, b ), ... );
+    }
+
+    template < size_t... r >
+    static auto makeOutput( std::index_sequence< r... > )
+    {
+      return Eigen::TensorFixedSize< Scalar, Eigen::Sizes< dimensionsC[r]... > >();
+    }
+  };
+
+  /**
+   * Contraction of \ref A and \ref B in Einstein notation, generated and fully unrolled at compile time, e.g.,
+   *
+   *   // C_ij = A_ijkl B_kl
+   *   contract< Indices< 'i', 'j', 'k', 'l' >, Indices< 'k', 'l' >, Indices< 'i', 'j' > >( A, B );
+   *
+   *   // axial vector w_i = 1/2 e_ijk W_jk of a skew tensor
+   *   0.5 * contract< Indices< 'i', 'j', 'k' >, Indices< 'j', 'k' >, Indices< 'i' > >( LeviCivita3D(), W );
+   *
+   * Labels missing in the output \ref IC are summed over. Operands are Eigen::TensorFixedSize, fixed size
+   * Eigen::Matrix, maps of both, or compile-time constants (\ref LeviCivita3D, \ref KroneckerDelta), whose zero entries
+   * are skipped. No temporaries are created, and contractions of up to Contraction::maxUnrolledTerms terms are fully
+   * unrolled. The result is an Eigen::TensorFixedSize, or a scalar for an empty \ref IC.
+   */
+  template < typename IA, typename IB, typename IC, typename TA, typename TB >
+  auto contract( const TA& A, const TB& B )
+  {
+    using Plan = Contraction< IA, IB, IC, TA, TB >;
+
+    if constexpr ( IC::rank == 0 ) {
+      typename Plan::Scalar out( 0 );
+      Plan::evaluate( &out, A, B );
+      return out;
+    }
+    else {
+      auto out = Plan::makeOutput( std::make_index_sequence< IC::rank >() );
+      out.setZero();
+      Plan::evaluate( out.data(), A, B );
+      return out;
+    }
+  }
+
+  /**
+   * Single operand contraction, e.g., a trace or a permutation of indices:
+   *
+   *   // B_ikjl = A_ijkl
+   *   contract< Indices< 'i', 'j', 'k', 'l' >, Indices< 'i', 'k', 'j', 'l' > >( A );
+   */
+  template < typename IA, typename IC, typename TA >
+  auto contract( const TA& A )
+  {
+    return contract< IA, Indices<>, IC >( A, One() );
+  }
+
+} // namespace Marmot::ContinuumMechanics::TensorUtility::Einsum
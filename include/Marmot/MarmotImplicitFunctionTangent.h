@@ -0,0 +1,107 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotAutomaticDifferentiation.h"
+#include "Marmot/MarmotProfiling.h"
+#include <stdexcept>
+
+namespace Marmot::NumericalAlgorithms {
+
+  /**
+   * Algorithmic tangent \f$ \frac{d X}{d \varepsilon} = - \left( \frac{\partial R}{\partial X} \right)^{-1}
+   * \frac{\partial R}{\partial \varepsilon} \f$ of the converged solution \ref X of a local Newton solve \f$ R( X,
+   * \varepsilon ) = 0 \f$ by the implicit function theorem.
+   *
+   * \ref dR_dX is the factorization of \f$ \frac{\partial R}{\partial X} \f$ already computed by the Newton loop, e.g.,
+   * DenseSolvers::LU< nX > or Eigen::PartialPivLU; any type providing solve() for a matrix right hand side is accepted.
+   * Only \f$ \frac{\partial R}{\partial \varepsilon} \f$ is computed, by forward mode AD with \ref nEps
+   * evaluations of the generic callable \ref R( Eigen::Matrix< dual, nX, 1 >, Eigen::Matrix< dual, nEps, 1 > ). This
+   * replaces the \ref nEps perturbed Newton solves of a finite difference tangent of the return map.
+   *
+   * If the factorization stems from the last iteration before the final update, the tangent is accurate to the order of
+   * that update; refactorize at \ref X if that is not sufficient. */
+  template < typename Factorization, typename residualType, int nX, int nEps >
+  Eigen::Matrix< double, nX, nEps > implicitFunctionTangent( const Factorization&                    dR_dX,
+                                                             const residualType&                     R,
+                                                             const Eigen::Matrix< double, nX, 1 >&   X,
+                                                             const Eigen::Matrix< double, nEps, 1 >& eps )
+  {
+    using autodiff::dual;
+    static_assert( nX > 0 && nEps > 0, "use the dynamic size version for dynamic sizes" );
+
+    MARMOT_PROFILE_SCOPE( "NumericalAlgorithms::implicitFunctionTangent" );
+
+    const Eigen::Matrix< dual, nX, 1 > X_      = X.template cast< dual >();
+    auto                               R_at_X_ = [&]( const Eigen::Matrix< dual, nEps, 1 >& eps_ ) {
+      return R( X_, eps_ );
+    };
+
+    const Eigen::Matrix< double, nX, nEps > dR_dEps = AutomaticDifferentiation::jacobian< nX >( R_at_X_, eps ).second;
+
+    return -dR_dX.solve( dR_dEps );
+  }
+
+  using residual_function_type_dual = std::function< autodiff::VectorXdual( const autodiff::VectorXdual& X,
+                                                                           const autodiff::VectorXdual& eps ) >;
+
+  /**
+   * Dynamic size version of \ref implicitFunctionTangent for a residual \ref R( X, eps ) operating on VectorXdual */
+  template < typename Factorization >
+  Eigen::MatrixXd implicitFunctionTangent( const Factorization&                dR_dX,
+                                           const residual_function_type_dual& R,
+                                           const Eigen::VectorXd&              X,
+                                           const Eigen::VectorXd&              eps )
+  {
+    using namespace autodiff;
+
+    MARMOT_PROFILE_SCOPE( "NumericalAlgorithms::implicitFunctionTangent" );
+    MARMOT_PROFILE_COUNT_EVALUATIONS( eps.size() );
+
+    if ( dR_dX.rows() != X.size() )
+      throw std::invalid_argument( "implicitFunctionTangent: factorization does not match the size of X" );
+
+    const VectorXdual X_   = X.cast< dual >();
+    VectorXdual       eps_ = eps.cast< dual >();
+    Eigen::MatrixXd   dR_dEps( X.size(), eps.size() );
+
+    for ( Eigen::Index j = 0; j < eps.size(); j++ ) {
+      seed< 1 >( eps_( j ), 1.0 );
+      const VectorXdual R_ = R( X_, eps_ );
+      seed< 1 >( eps_( j ), 0.0 );
+
+      if ( R_.size() != X.size() )
+        throw std::invalid_argument( "implicitFunctionTangent: residual must be sized according to X" );
+
+      for ( Eigen::Index i = 0; i < R_.size(); i++ )
+        dR_dEps( i, j ) = derivative< 1 >( R_( i ) );
+    }
+
+    return -dR_dX.solve( dR_dEps );
+  }
+
+} // namespace Marmot::NumericalAlgorithms
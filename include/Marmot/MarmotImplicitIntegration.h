@@ -0,0 +1,451 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotAutomaticDifferentiation.h"
+#include "Marmot/MarmotProfiling.h"
+#include "Marmot/MarmotTypedefs.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Marmot {
+  namespace Math {
+
+    enum class ImplicitScheme { backwardEuler, BDF2, RadauIIA };
+
+    /**
+     * Settings of \ref integrateImplicit. Local errors and Newton corrections are measured in the maximum norm, scaled
+     * componentwise by \ref absoluteTolerance + \ref relativeTolerance \f$ |y| \f$ */
+    struct ImplicitIntegrationOptions {
+      double relativeTolerance   = 1e-6;
+      double absoluteTolerance   = 1e-8;
+      double newtonTolerance     = 1e-3; ///< scaled Newton correction at which the iteration is converged
+      int    maxNewtonIterations = 8;
+      int    maxSteps            = 500;
+      double initialStep         = 0;    ///< size of the first step, 0 for the entire interval
+      double minStepFactor       = 0.2;
+      double maxStepFactor       = 5;
+      double safetyFactor        = 0.9;
+      double jacobianUpdateRate  = 1e-3; ///< Newton contraction rate above which the Jacobian is reevaluated
+    };
+
+    template < int ySize >
+    struct ImplicitIntegrationResult {
+      Eigen::Matrix< double, ySize, 1 > y;
+      double                            nextStep; ///< proposed size of a subsequent step, e.g., for the next increment
+      int                               acceptedSteps;
+      int                               rejectedSteps;
+      int                               jacobianEvaluations;
+      int                               factorizations;
+      bool                              converged;
+    };
+
+    namespace ImplicitIntegration {
+
+      /**
+       * Order of the local error estimate of \ref scheme, governing the step size control */
+      constexpr int errorOrder( ImplicitScheme scheme )
+      {
+        return scheme == ImplicitScheme::backwardEuler ? 2 : scheme == ImplicitScheme::BDF2 ? 3 : 4;
+      }
+
+      /**
+       * Coefficients of the 3-stage Radau IIA method of order 5 and its embedded error estimator, cf. Hairer & Wanner
+       * (1996) Solving Ordinary Differential Equations II, Sec. IV.8 */
+      namespace RadauIIA {
+        constexpr double sqrt6  = 2.449489742783178098197284;
+        constexpr double A[3][3] = { { ( 88. - 7. * sqrt6 ) / 360.,
+                                       ( 296. - 169. * sqrt6 ) / 1800.,
+                                       ( -2. + 3. * sqrt6 ) / 225. },
+                                     { ( 296. + 169. * sqrt6 ) / 1800.,
+                                       ( 88. + 7. * sqrt6 ) / 360.,
+                                       ( -2. - 3. * sqrt6 ) / 225. },
+                                     { ( 16. - sqrt6 ) / 36., ( 16. + sqrt6 ) / 36., 1. / 9. } };
+        constexpr double gamma0 = 0.2748888295956773; // inverse of the real eigenvalue of A^-1
+        constexpr double e[3]   = { -( 13. + 7. * sqrt6 ) / 3., ( -13. + 7. * sqrt6 ) / 3., -1. / 3. };
+      } // namespace RadauIIA
+
+      struct NewtonStatus {
+        bool   converged;
+        double rate;
+        int    iterations;
+      };
+
+      /**
+       * Simplified Newton iteration for \ref residual( x ) = 0 with the fixed factorized iteration matrix \ref lu. The
+       * iteration stops if the estimated distance to the solution, \f$ \frac{\theta}{1-\theta} \|\Delta x\| \f$ with
+       * the contraction rate \f$ \theta \f$, falls below the tolerance, or fails if \f$ \theta \geq 0.9 \f$ */
+      template < typename xType, typename residualType, typename luType, typename normType >
+      NewtonStatus simplifiedNewton( xType&                            x,
+                                     const residualType&               residual,
+                                     const luType&                     lu,
+                                     const normType&                   norm,
+                                     const ImplicitIntegrationOptions& options )
+      {
+        double previousNorm = 0;
+        double rate         = 0;
+
+        for ( int i = 1; i <= options.maxNewtonIterations; i++ ) {
+          const xType  dx     = lu.solve( -residual( x ) );
+          const double dxNorm = norm( dx );
+          x += dx;
+
+          if ( i > 1 ) {
+            rate = dxNorm / previousNorm;
+            if ( rate >= 0.9 )
+              return { false, rate, i };
+          }
+
+          const double eta = i == 1 ? 1. : rate / ( 1. - rate );
+          if ( eta * dxNorm <= options.newtonTolerance )
+            return { true, rate, i };
+
+          previousNorm = dxNorm;
+        }
+
+        return { false, rate, options.maxNewtonIterations };
+      }
+
+      /**
+       * Fixed size implicit integrator; the Jacobian and the factorizations of the iteration matrices are kept across
+       * Newton iterations, stages and steps as long as the Newton iteration converges fast and the step size is
+       * unchanged */
+      template < int n >
+      class Integrator {
+
+      public:
+        using Vector = Eigen::Matrix< double, n, 1 >;
+        using Matrix = Eigen::Matrix< double, n, n >;
+
+        static_assert( n > 0, "the implicit integrators require a fixed size state" );
+
+        Integrator( ImplicitScheme scheme, const ImplicitIntegrationOptions& options )
+          : scheme( scheme ), options( options )
+        {
+        }
+
+        template < typename functionType, typename dualFunctionType >
+        ImplicitIntegrationResult< n > integrate( const Vector&           y0,
+                                                  const double            deltaT,
+                                                  const functionType&     f,
+                                                  const dualFunctionType& fDual )
+        {
+          ImplicitIntegrationResult< n > result{ y0, deltaT, 0, 0, 0, 0, false };
+
+          Vector& y = result.y;
+          double  t = 0;
+          double  h = options.initialStep > 0 ? std::min( options.initialStep, deltaT ) : deltaT;
+
+          updateJacobian( y, fDual, result );
+
+          while ( t < deltaT ) {
+            if ( result.acceptedSteps + result.rejectedSteps >= options.maxSteps ||
+                 h <= 16 * std::numeric_limits< double >::epsilon() * deltaT ) {
+              result.nextStep = h;
+              return result;
+            }
+
+            // avoid a tiny remainder at the end of the interval
+            const double remainder = deltaT - t;
+            const double step      = h >= 0.99 * remainder ? remainder : h;
+
+            Vector             yNew;
+            double             error;
+            const NewtonStatus status = this->step( y, step, f, yNew, error, result );
+
+            if ( !status.converged ) {
+              if ( !jacobianIsCurrent )
+                updateJacobian( y, fDual, result );
+              else {
+                h = 0.5 * step;
+                result.rejectedSteps++;
+              }
+              continue;
+            }
+
+            const double exponent = -1. / errorOrder( hasHistory ? scheme : startingScheme() );
+            double       factor   = error > 0 ? options.safetyFactor * std::pow( error, exponent )
+                                              : options.maxStepFactor;
+            factor                = std::max( options.minStepFactor, std::min( options.maxStepFactor, factor ) );
+
+            if ( error > 1 ) {
+              h = std::min( factor, 1. ) * step;
+              result.rejectedSteps++;
+              continue;
+            }
+
+            yPrevious  = y;
+            hPrevious  = step;
+            hasHistory = true;
+            y          = yNew;
+            t += step;
+            result.acceptedSteps++;
+
+            if ( status.rate > options.jacobianUpdateRate )
+              updateJacobian( y, fDual, result );
+            else {
+              fY                = f( y );
+              jacobianIsCurrent = false;
+            }
+
+            // keep the step size, and thus the factorizations, for moderate increases
+            if ( factor >= 1 && factor <= 1.2 )
+              factor = 1;
+            h = factor * step;
+          }
+
+          result.nextStep  = h;
+          result.converged = true;
+          return result;
+        }
+
+      private:
+        ImplicitScheme startingScheme() const
+        {
+          return scheme == ImplicitScheme::BDF2 ? ImplicitScheme::backwardEuler : scheme;
+        }
+
+        template < typename dualFunctionType >
+        void updateJacobian( const Vector& y, const dualFunctionType& fDual, ImplicitIntegrationResult< n >& result )
+        {
+          std::tie( fY, J ) = AutomaticDifferentiation::jacobian< n >( fDual, y );
+          jacobianIsCurrent = true;
+          jacobianVersion++;
+          result.jacobianEvaluations++;
+        }
+
+        /**
+         * Factorizes \f$ I - \gamma J \f$, unless already done for the current Jacobian */
+        void factorize( const double gamma, ImplicitIntegrationResult< n >& result )
+        {
+          if ( gamma == factorizedGamma && jacobianVersion == factorizedVersion )
+            return;
+
+          lu.compute( Matrix::Identity() - gamma * J );
+          factorizedGamma   = gamma;
+          factorizedVersion = jacobianVersion;
+          result.factorizations++;
+        }
+
+        double scaledNorm( const Vector& v, const Vector& yA, const Vector& yB ) const
+        {
+          const Vector scale = options.absoluteTolerance +
+                               options.relativeTolerance * yA.array().abs().max( yB.array().abs() );
+          return ( v.array().abs() / scale.array() ).maxCoeff();
+        }
+
+        template < typename functionType >
+        NewtonStatus step( const Vector&                   y,
+                           const double                    h,
+                           const functionType&             f,
+                           Vector&                         yNew,
+                           double&                         error,
+                           ImplicitIntegrationResult< n >& result )
+        {
+          if ( scheme == ImplicitScheme::RadauIIA )
+            return stepRadauIIA( y, h, f, yNew, error, result );
+          if ( scheme == ImplicitScheme::BDF2 && hasHistory )
+            return stepBDF2( y, h, f, yNew, error, result );
+          return stepBackwardEuler( y, h, f, yNew, error, result );
+        }
+
+        /**
+         * \f$ y_{n+1} = y_n + h\, f( y_{n+1} ) \f$; the local error is estimated from the explicit Euler predictor */
+        template < typename functionType >
+        NewtonStatus stepBackwardEuler( const Vector&                   y,
+                                        const double                    h,
+                                        const functionType&             f,
+                                        Vector&                         yNew,
+                                        double&                         error,
+                                        ImplicitIntegrationResult< n >& result )
+        {
+          factorize( h, result );
+
+          const Vector yPredicted = y + h * fY;
+          yNew                    = yPredicted;
+
+          const NewtonStatus status = simplifiedNewton(
+            yNew,
+            [&]( const Vector& x ) -> Vector { return x - y - h * f( x ); },
+            lu,
+            [&]( const Vector& dx ) { return scaledNorm( dx, y, y ); },
+            options );
+
+          // filtered by the iteration matrix to remain meaningful for stiff components
+          error = scaledNorm( lu.solve( 0.5 * ( yNew - yPredicted ) ), y, yNew );
+          return status;
+        }
+
+        /**
+         * Variable step BDF2, \f$ y_{n+1} - \frac{(1+\omega)^2}{1+2\omega} y_n + \frac{\omega^2}{1+2\omega} y_{n-1} =
+         * \frac{1+\omega}{1+2\omega} h\, f( y_{n+1} ) \f$ with \f$ \omega = h_{n+1} / h_n \f$; the local error is
+         * estimated from a quadratic Hermite predictor with the constant step error constants */
+        template < typename functionType >
+        NewtonStatus stepBDF2( const Vector&                   y,
+                               const double                    h,
+                               const functionType&             f,
+                               Vector&                         yNew,
+                               double&                         error,
+                               ImplicitIntegrationResult< n >& result )
+        {
+          const double omega  = h / hPrevious;
+          const double alpha1 = ( 1 + omega ) * ( 1 + omega ) / ( 1 + 2 * omega );
+          const double alpha2 = omega * omega / ( 1 + 2 * omega );
+          const double beta   = ( 1 + omega ) / ( 1 + 2 * omega );
+
+          factorize( beta * h, result );
+
+          const Vector curvature  = ( yPrevious - y + hPrevious * fY ) / ( hPrevious * hPrevious );
+          const Vector yPredicted = y + h * fY + h * h * curvature;
+          yNew                    = yPredicted;
+
+          const NewtonStatus status = simplifiedNewton(
+            yNew,
+            [&]( const Vector& x ) -> Vector { return x - alpha1 * y + alpha2 * yPrevious - beta * h * f( x ); },
+            lu,
+            [&]( const Vector& dx ) { return scaledNorm( dx, y, y ); },
+            options );
+
+          error = scaledNorm( lu.solve( 0.4 * ( yNew - yPredicted ) ), y, yNew );
+          return status;
+        }
+
+        /**
+         * 3-stage Radau IIA method of order 5 for the stage increments \f$ z_i = h \sum_j a_{ij} f( y_n + z_j ) \f$,
+         * solved by a simplified Newton iteration with the single factorization of \f$ I - h\, A \otimes J \f$ for all
+         * stages; the error estimate of the embedded method of order 3 reuses the Jacobian */
+        template < typename functionType >
+        NewtonStatus stepRadauIIA( const Vector&                   y,
+                                   const double                    h,
+                                   const functionType&             f,
+                                   Vector&                         yNew,
+                                   double&                         error,
+                                   ImplicitIntegrationResult< n >& result )
+        {
+          using StageVector = Eigen::Matrix< double, 3 * n, 1 >;
+          using StageMatrix = Eigen::Matrix< double, 3 * n, 3 * n >;
+
+          factorize( RadauIIA::gamma0 * h, result );
+
+          if ( h != factorizedStageStep || jacobianVersion != factorizedStageVersion ) {
+            StageMatrix M;
+            for ( int i = 0; i < 3; i++ )
+              for ( int j = 0; j < 3; j++ )
+                M.template block< n, n >( i * n, j * n ) = ( i == j ? 1. : 0. ) * Matrix::Identity() -
+                                                           h * RadauIIA::A[i][j] * J;
+            stageLu.compute( M );
+            factorizedStageStep    = h;
+            factorizedStageVersion = jacobianVersion;
+            result.factorizations++;
+          }
+
+          const auto residual = [&]( const StageVector& Z ) -> StageVector {
+            Vector F[3];
+            for ( int j = 0; j < 3; j++ )
+              F[j] = f( y + Z.template segment< n >( j * n ) );
+
+            StageVector R = Z;
+            for ( int i = 0; i < 3; i++ )
+              for ( int j = 0; j < 3; j++ )
+                R.template segment< n >( i * n ) -= h * RadauIIA::A[i][j] * F[j];
+            return R;
+          };
+
+          const auto stageNorm = [&]( const StageVector& dZ ) {
+            double norm = 0;
+            for ( int i = 0; i < 3; i++ )
+              norm = std::max( norm, scaledNorm( dZ.template segment< n >( i * n ), y, y ) );
+            return norm;
+          };
+
+          StageVector        Z      = StageVector::Zero();
+          const NewtonStatus status = simplifiedNewton( Z, residual, stageLu, stageNorm, options );
+
+          // stiffly accurate: the solution is the last stage
+          yNew = y + Z.template segment< n >( 2 * n );
+
+          Vector difference = RadauIIA::gamma0 * h * fY;
+          for ( int i = 0; i < 3; i++ )
+            difference += RadauIIA::gamma0 * RadauIIA::e[i] * Z.template segment< n >( i * n );
+          error = scaledNorm( lu.solve( difference ), y, yNew );
+
+          return status;
+        }
+
+        const ImplicitScheme              scheme;
+        const ImplicitIntegrationOptions& options;
+
+        Vector fY;
+        Matrix J;
+        bool   jacobianIsCurrent = false;
+        int    jacobianVersion   = 0;
+
+        Eigen::PartialPivLU< Matrix > lu;
+        double                        factorizedGamma   = 0;
+        int                           factorizedVersion = -1;
+
+        Eigen::PartialPivLU< Eigen::Matrix< double, 3 * n, 3 * n > > stageLu;
+        double                                                       factorizedStageStep    = 0;
+        int                                                          factorizedStageVersion = -1;
+
+        Vector yPrevious;
+        double hPrevious  = 0;
+        bool   hasHistory = false;
+      };
+    } // namespace ImplicitIntegration
+
+    /**
+     * Adaptive implicit integration of \f$ \dot y = f( y ) \f$, given by \ref fRate taking arguments \ref fRateArgs,
+     * from the initial value \ref y0 over the interval \ref deltaT, e.g., for stiff viscoplastic or creep laws. The
+     * Newton matrices use the forward mode AD Jacobian, hence \ref fRate must be callable with both
+     * Eigen::Matrix< double, ySize, 1 > and Eigen::Matrix< autodiff::dual, ySize, 1 >, e.g., a generic lambda.
+     * Available schemes are backward Euler (order 1), variable step BDF2 (order 2, started by backward Euler) and
+     * Radau IIA (order 5, L-stable); the step size is controlled by local error estimates */
+    template < int ySize, typename functionType, typename... Args >
+    ImplicitIntegrationResult< ySize > integrateImplicit( const ImplicitScheme                     scheme,
+                                                          const Eigen::Matrix< double, ySize, 1 >& y0,
+                                                          const double                             deltaT,
+                                                          const ImplicitIntegrationOptions&        options,
+                                                          functionType                             fRate,
+                                                          Args&&... fRateArgs )
+    {
+      MARMOT_PROFILE_SCOPE( "Math::integrateImplicit" );
+
+      const auto f = [&]( const Eigen::Matrix< double, ySize, 1 >& y ) -> Eigen::Matrix< double, ySize, 1 > {
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+        return fRate( y, fRateArgs... );
+      };
+      const auto fDual = [&]( const Eigen::Matrix< autodiff::dual, ySize, 1 >& y )
+        -> Eigen::Matrix< autodiff::dual, ySize, 1 > { return fRate( y, fRateArgs... ); };
+
+      ImplicitIntegration::Integrator< ySize > integrator( scheme, options );
+      return integrator.integrate( y0, deltaT, f, fDual );
+    }
+
+  } // namespace Math
+} // namespace Marmot
@@ -28,13 +28,20 @@
  */
 
 #pragma once
+#include "Marmot/MarmotBatch.h"
 #include "Marmot/MarmotConstants.h"
+#include "Marmot/MarmotDenseSolvers.h"
+#include "Marmot/MarmotProfiling.h"
 #include "Marmot/MarmotTypedefs.h"
 #include "autodiff/forward/dual.hpp"
 #include "autodiff/forward/real.hpp"
 #include <algorithm>
 #include <autodiff/forward/dual/dual.hpp>
 #include <complex>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace Marmot {
   namespace Math {
@@ -51,8 +58,33 @@ namespace Marmot {
     double linearInterpolation( double x, double x0, double x1, double y0, double y1 );
 
     /**
-     * exponential of value \ref x with numerical limits check */
-    double exp( double x );
+     * exponential of value \ref x with numerical limits check; inline and branch-free (select) to allow for
+     * vectorization in loops */
+    inline double exp( double x )
+    {
+      // underflow if arg < -708.4, overflow if arg > 709.8 (type double), leave ample margin (e.g. for squaring)
+      const double bounded = std::exp( std::min( std::max( x, -64. ), 64. ) );
+      return x <= -64 ? 0.0 : bounded;
+    }
+
+    /**
+     * coefficient-wise exponential of array \ref x with the same numerical limits as the scalar version; evaluated
+     * lazily using Eigen's vectorized exp */
+    template < typename Derived >
+    auto exp( const Eigen::ArrayBase< Derived >& x )
+    {
+      using Scalar = typename Derived::Scalar;
+      // Eigen's select is not vectorized, hence the lower bound is applied by an arithmetic 0/1 mask:
+      // ( x + 64 ) * max is >= 1 for all representable x > -64
+      const auto isAboveLowerBound = ( ( x + Scalar( 64 ) ) * std::numeric_limits< Scalar >::max() )
+                                       .max( Scalar( 0 ) )
+                                       .min( Scalar( 1 ) );
+      // NaN is propagated explicitly as in the scalar version, since the mask is undefined for NaN
+      const auto upperBound = Derived::Constant( x.rows(), x.cols(), Scalar( 64 ) );
+      return x.binaryExpr( upperBound, Eigen::internal::scalar_min_op< Scalar, Scalar, Eigen::PropagateNaN >() )
+               .exp() *
+             isAboveLowerBound;
+    }
 
     /**
      * compute the exponent to the power of ten of an expression, e.g., 5*10^5 --> return 5 */
@@ -88,12 +120,72 @@ namespace Marmot {
 
     /**
      * Extract sign of value \ref val*/
-    template < typename T >
+    template < typename T, typename = std::enable_if_t< !std::is_base_of< Eigen::EigenBase< T >, T >::value > >
     constexpr T sgn( T val )
     {
       return val / std::abs( val );
     }
 
+    /**
+     * Macaulay function applied coefficient-wise to array \ref x; NaN yields 0 as for the scalar version */
+    template < typename Derived >
+    auto macauly( const Eigen::ArrayBase< Derived >& x )
+    {
+      using Scalar = typename Derived::Scalar;
+      return x.binaryExpr( Derived::Zero( x.rows(), x.cols() ),
+                           Eigen::internal::scalar_max_op< Scalar, Scalar, Eigen::PropagateNumbers >() );
+    }
+
+    /**
+     * Heaviside function applied coefficient-wise to array \ref x, returned with the scalar type of \ref x */
+    template < typename Derived >
+    auto heaviside( const Eigen::ArrayBase< Derived >& x )
+    {
+      return ( x >= typename Derived::Scalar( 0 ) ).template cast< typename Derived::Scalar >();
+    }
+
+    /**
+     * Sign of array \ref x, coefficient-wise, with the same semantics as the scalar version */
+    template < typename Derived >
+    auto sgn( const Eigen::ArrayBase< Derived >& x )
+    {
+      return x / x.abs();
+    }
+
+    /**
+     * Elementwise kernels applied to all lanes and coefficients of a Batch */
+    template < typename T, int K >
+    Batch< T, K > exp( const Batch< T, K >& x )
+    {
+      Batch< T, K > out( x.lanes() );
+      out.data = Math::exp( x.data );
+      return out;
+    }
+
+    template < typename T, int K >
+    Batch< T, K > macauly( const Batch< T, K >& x )
+    {
+      Batch< T, K > out( x.lanes() );
+      out.data = Math::macauly( x.data );
+      return out;
+    }
+
+    template < typename T, int K >
+    Batch< T, K > heaviside( const Batch< T, K >& x )
+    {
+      Batch< T, K > out( x.lanes() );
+      out.data = Math::heaviside( x.data );
+      return out;
+    }
+
+    template < typename T, int K >
+    Batch< T, K > sgn( const Batch< T, K >& x )
+    {
+      Batch< T, K > out( x.lanes() );
+      out.data = Math::sgn( x.data );
+      return out;
+    }
+
     double makeReal( const double& value );
     double makeReal( const std::complex< double >& value );
     double makeReal( const autodiff::real& value );
@@ -104,46 +196,40 @@ namespace Marmot {
       return double( number );
     }
 
-    template < typename T, size_t... Rest >
-    Eigen::Matrix< double, Rest... > makeReal( const Eigen::Matrix< T, Rest... > mat )
+    /**
+     * Real part of a matrix of scalars (double, complex, dual, ...) as lazy, zero-copy Eigen expression. Works on any
+     * dense expression, including fixed size matrices, maps and blocks. As for all Eigen expressions, the result must
+     * be evaluated (e.g., assigned to a matrix) before \ref mat goes out of scope. */
+    template < typename Derived >
+    auto realView( const Eigen::MatrixBase< Derived >& mat )
     {
-      Eigen::Matrix< double, Rest... > out;
-      const size_t                     m = static_cast< size_t >( mat.rows() );
-      const size_t                     n = static_cast< size_t >( mat.cols() );
-
-      for ( size_t i = 0; i < m; i++ ) {
-        for ( size_t j = 0; j < n; j++ ) {
-          out( i, j ) = makeReal( mat( i, j ) );
-        }
-      }
-      return out;
+      return mat.unaryExpr( []( const typename Derived::Scalar& value ) -> double { return makeReal( value ); } );
     }
 
-    template < typename T >
-    Eigen::VectorXd makeReal( Eigen::Vector< T, Eigen::Dynamic > in )
+    /**
+     * Real part of a matrix of scalars (double, complex, dual, ...), returned as a matrix of the same size */
+    template < typename Derived >
+    typename decltype( realView( std::declval< const Eigen::MatrixBase< Derived >& >() ) )::PlainObject makeReal(
+      const Eigen::MatrixBase< Derived >& mat )
     {
+      return realView( mat );
+    }
 
-      int             inSize = in.size();
-      Eigen::VectorXd out( inSize );
-      for ( int i = 0; i < inSize; i++ ) {
-        out( i ) = double( in( i ) );
-      }
-      return out;
+    /**
+     * Write the real part of \ref mat into the caller owned storage \ref out (e.g., a matrix, map or block) of the
+     * same size, without allocating. */
+    template < typename Derived, typename OtherDerived >
+    void makeReal( const Eigen::MatrixBase< Derived >& mat, Eigen::MatrixBase< OtherDerived >& out )
+    {
+      out.noalias() = realView( mat );
     }
 
     /**
-     * apply Macaulay function to a matrix
-     * @todo: Can be replaced easily with Eigen's array() functionality ??? */
+     * apply Macaulay function to a matrix */
     template < int nRows, int nCols >
     Eigen::Matrix< double, nRows, nCols > macaulyMatrix( const Eigen::Matrix< double, nRows, nCols >& mat )
     {
-      Eigen::Matrix< double, nRows, nCols > positivePart = Eigen::Matrix< double, nRows, nCols >::Zero();
-      for ( int i = 0; i < nRows; i++ ) {
-        for ( int j = 0; j < nCols; j++ ) {
-          positivePart( i, j ) = macauly( mat( i, j ) );
-        }
-      }
-      return positivePart;
+      return mat.cwiseMax( 0.0 );
     }
 
     /**
@@ -151,56 +237,74 @@ namespace Marmot {
     template < typename functionType, typename yType, typename... Args >
     yType explicitEuler( yType yN, const double dt, functionType fRate, Args&&... fRateArgs )
     {
+      MARMOT_PROFILE_SCOPE( "Math::explicitEuler" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
       return yN + fRate( yN, fRateArgs... ) * dt;
     }
 
     /**
      * Semi-implicit Euler integration of function \ref fRate taking arguments \ref fRateArgs and initial value \ref yN
-     * using central difference scheme for computing
-     * @todo: Replace inverse bei solving equation system?
+     * using central difference scheme for computing; the scalar type of \ref y may be float, double or long double
      * @todo: Use external central difference function? */
-    template < int ySize, typename functionType, typename... Args >
-    Eigen::Matrix< double, ySize, 1 > semiImplicitEuler( Eigen::Matrix< double, ySize, 1 > yN,
-                                                         const double                      dt,
-                                                         functionType                      fRate,
-                                                         Args&&... fRateArgs )
+    template < int ySize, typename Derived, typename functionType, typename... Args >
+    Eigen::Matrix< typename Derived::Scalar, ySize, 1 > semiImplicitEuler( const Eigen::MatrixBase< Derived >& y,
+                                                                           const typename Derived::Scalar      dt,
+                                                                           functionType                        fRate,
+                                                                           Args&&... fRateArgs )
     {
-      Eigen::Matrix< double, ySize, ySize > fS = Eigen::Matrix< double, ySize, ySize >::Zero();
-      Eigen::Matrix< double, ySize, ySize > Iy = Eigen::Matrix< double, ySize, ySize >::Identity();
+      using T = typename Derived::Scalar;
+
+      MARMOT_PROFILE_SCOPE( "Math::semiImplicitEuler" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 * ySize + 1 );
 
-      Eigen::VectorXd leftX( ySize );
-      Eigen::VectorXd rightX( ySize );
+      const Eigen::Matrix< T, ySize, 1 > yN = y;
+
+      Eigen::Matrix< T, ySize, ySize > fS = Eigen::Matrix< T, ySize, ySize >::Zero();
+      Eigen::Matrix< T, ySize, ySize > Iy = Eigen::Matrix< T, ySize, ySize >::Identity();
+
+      Eigen::Matrix< T, ySize, 1 > leftX;
+      Eigen::Matrix< T, ySize, 1 > rightX;
 
       for ( size_t i = 0; i < ySize; i++ ) {
-        double volatile h = std::max( 1.0, std::abs( yN( i ) ) ) * Constants::cubicRootEps();
+        T volatile h = std::max( T( 1 ), std::abs( yN( i ) ) ) * Constants::cbrtEps< T >;
         leftX             = yN;
         leftX( i ) -= h;
         rightX = yN;
         rightX( i ) += h;
-        fS.col( i ) = 1. / ( 2. * h ) * ( fRate( rightX, fRateArgs... ) - fRate( leftX, fRateArgs... ) );
+        fS.col( i ) = T( 1 ) / ( 2 * h ) * ( fRate( rightX, fRateArgs... ) - fRate( leftX, fRateArgs... ) );
       }
 
-      return yN + ( Iy - dt * fS ).inverse() * dt * fRate( yN, fRateArgs... );
+      const NumericalAlgorithms::DenseSolvers::LU< ySize, T > lu( Iy - dt * fS );
+      return yN + lu.solve( dt * fRate( yN, fRateArgs... ) );
     }
 
     /**
      * returns central numerical differentiation of a vector-valued function \ref f with respect to vector \ref X
-     * --> use std::bind to create function f(x) from function with multiple arguments */
-    template < int nRows, int nCols, typename functionType >
-    Eigen::Matrix< double, nRows, nCols > centralDiff( functionType f, const Eigen::Matrix< double, nCols, 1 >& X )
+     * --> use std::bind to create function f(x) from function with multiple arguments; the step size is derived from
+     * the machine epsilon of the scalar type of \ref x */
+    template < int nRows, int nCols, typename functionType, typename Derived >
+    Eigen::Matrix< typename Derived::Scalar, nRows, nCols > centralDiff( functionType                        f,
+                                                                         const Eigen::MatrixBase< Derived >& x )
     {
-      Eigen::Matrix< double, nRows, nCols > dXdY = Eigen::Matrix< double, nRows, nCols >::Zero();
+      using T = typename Derived::Scalar;
+
+      MARMOT_PROFILE_SCOPE( "Math::centralDiff" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 * nCols );
+
+      const Eigen::Matrix< T, nCols, 1 > X    = x;
+      Eigen::Matrix< T, nRows, nCols >   dXdY = Eigen::Matrix< T, nRows, nCols >::Zero();
 
-      Eigen::VectorXd leftX( nCols );
-      Eigen::VectorXd rightX( nCols );
+      Eigen::Matrix< T, nCols, 1 > leftX;
+      Eigen::Matrix< T, nCols, 1 > rightX;
 
       for ( size_t i = 0; i < nCols; i++ ) {
-        double volatile h = std::max( 1.0, std::abs( X( i ) ) ) * Constants::cubicRootEps();
-        leftX             = X;
+        T volatile h = std::max( T( 1 ), std::abs( X( i ) ) ) * Constants::cbrtEps< T >;
+        leftX        = X;
         leftX( i ) -= h;
         rightX = X;
         rightX( i ) += h;
-        dXdY.col( i ) = 1. / ( 2. * h ) * ( f( rightX ) - f( leftX ) );
+        dXdY.col( i ) = T( 1 ) / ( 2 * h ) * ( f( rightX ) - f( leftX ) );
       }
 
       return dXdY;
@@ -213,6 +317,9 @@ namespace Marmot {
     template < typename functionType, typename yType, typename... Args >
     yType explicitEulerRichardson( yType yN, const double dt, functionType fRate, Args&&... fRateArgs )
     {
+      MARMOT_PROFILE_SCOPE( "Math::explicitEulerRichardson" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 );
+
       yType fN = fRate( yN, fRateArgs... );
       yType u  = yN + fN * dt;
       yType v  = yN + fN * dt / 2.;
@@ -222,43 +329,225 @@ namespace Marmot {
     }
 
     /**
-     *  Explicit Euler integration with error estimation based on Richardson extrapolation of function \ref fRate taking
-     * arguments \ref fRateArgs and initial value \ref yN .
+     *  Explicit Euler step with Richardson extrapolation and error estimation, given the rate \ref fN at the initial
+     * value \ref yN ; returns the new value, the proposed next step size and the estimated error, which is acceptable
+     * if below \ref TOL
      * */
-    template < int ySize, typename functionType, typename... Args >
-    std::tuple< Eigen::Matrix< double, ySize, 1 >, double > explicitEulerRichardsonWithErrorEstimator(
-      Eigen::Matrix< double, ySize, 1 > yN,
-      const double                      dt,
-      const double                      TOL,
-      functionType                      fRate,
+    template < int ySize, typename T, typename functionType, typename... Args >
+    std::tuple< Eigen::Matrix< T, ySize, 1 >, T, T > explicitEulerRichardsonStep(
+      const Eigen::Matrix< T, ySize, 1 >& yN,
+      const Eigen::Matrix< T, ySize, 1 >& fN,
+      const std::common_type_t< T >       dt,
+      const std::common_type_t< T >       TOL,
+      functionType                        fRate,
       Args&&... fRateArgs )
     {
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
 
-      typedef Eigen::Matrix< double, ySize, 1 > ySized;
-      ySized                                    fN   = fRate( yN, fRateArgs... );
-      ySized                                    u    = yN + fN * dt;
-      ySized                                    v    = yN + fN * dt / 2.;
-      ySized                                    w    = v + fRate( v, fRateArgs... ) * dt / 2.;
-      ySized                                    yNew = 2. * w - u;
+      typedef Eigen::Matrix< T, ySize, 1 > ySized;
+      ySized                               u    = yN + fN * dt;
+      ySized                               v    = yN + fN * dt / 2;
+      ySized                               w    = v + fRate( v, fRateArgs... ) * dt / 2;
+      ySized                               yNew = 2 * w - u;
 
       // error estimator
-      const double AERR    = 1.0;
-      const double aI      = AERR / TOL;
-      const double rI      = 1.0;
-      double       scaling = 0;
-      ySized       ESTVec  = ySized::Zero();
+      const T AERR    = 1.0;
+      const T aI      = AERR / TOL;
+      const T rI      = 1.0;
+      T       scaling = 0;
+      ySized  ESTVec  = ySized::Zero();
 
       for ( int i = 0; i < ySize; i++ ) {
-        scaling     = aI + rI * std::max( abs( yNew( i ) ), abs( yN( i ) ) );
-        ESTVec( i ) = abs( w( i ) - u( i ) ) / abs( scaling );
+        scaling     = aI + rI * std::max( std::abs( yNew( i ) ), std::abs( yN( i ) ) );
+        ESTVec( i ) = std::abs( w( i ) - u( i ) ) / std::abs( scaling );
       }
 
-      const double EST    = ESTVec.maxCoeff();
-      const double tauNew = dt * std::min( 2., std::max( 0.2, 0.9 * std::sqrt( TOL / EST ) ) );
+      const T EST    = ESTVec.maxCoeff();
+      const T tauNew = dt * std::min( T( 2 ), std::max( T( 0.2 ), T( 0.9 ) * std::sqrt( TOL / EST ) ) );
+
+      return std::make_tuple( yNew, tauNew, EST );
+    }
+
+    /**
+     *  Explicit Euler integration with error estimation based on Richardson extrapolation of function \ref fRate taking
+     * arguments \ref fRateArgs and initial value \ref y .
+     * */
+    template < int ySize, typename Derived, typename functionType, typename... Args >
+    std::tuple< Eigen::Matrix< typename Derived::Scalar, ySize, 1 >, typename Derived::Scalar >
+    explicitEulerRichardsonWithErrorEstimator( const Eigen::MatrixBase< Derived >& y,
+                                               const typename Derived::Scalar      dt,
+                                               const typename Derived::Scalar      TOL,
+                                               functionType                        fRate,
+                                               Args&&... fRateArgs )
+    {
+      using T = typename Derived::Scalar;
+
+      MARMOT_PROFILE_SCOPE( "Math::explicitEulerRichardsonWithErrorEstimator" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+      const Eigen::Matrix< T, ySize, 1 > yN = y;
+
+      const Eigen::Matrix< T, ySize, 1 > fN = fRate( yN, fRateArgs... );
+      Eigen::Matrix< T, ySize, 1 >       yNew;
+      T                                  tauNew;
+      std::tie( yNew, tauNew, std::ignore ) = explicitEulerRichardsonStep< ySize >( yN,
+                                                                                    fN,
+                                                                                    dt,
+                                                                                    TOL,
+                                                                                    fRate,
+                                                                                    fRateArgs... );
 
       return std::make_tuple( yNew, tauNew );
     }
 
+    /**
+     * Cubic Hermite interpolant of a step from \ref y0 to \ref y1 of size \ref dt with the rates \ref f0 and \ref f1
+     * at its ends, for dense output of one step integrators */
+    template < int ySize, typename T >
+    struct HermiteInterpolant {
+      Eigen::Matrix< T, ySize, 1 > y0;
+      Eigen::Matrix< T, ySize, 1 > y1;
+      Eigen::Matrix< T, ySize, 1 > f0;
+      Eigen::Matrix< T, ySize, 1 > f1;
+      T                            dt;
+
+      /**
+       * Value at the relative position \ref theta in [0, 1] within the step */
+      Eigen::Matrix< T, ySize, 1 > operator()( const T theta ) const
+      {
+        const T theta2 = theta * theta;
+        const T theta3 = theta2 * theta;
+        const T h00    = 2 * theta3 - 3 * theta2 + 1;
+        const T h10    = theta3 - 2 * theta2 + theta;
+        const T h01    = -2 * theta3 + 3 * theta2;
+        const T h11    = theta3 - theta2;
+
+        return h00 * y0 + h10 * dt * f0 + h01 * y1 + h11 * dt * f1;
+      }
+    };
+
+    /**
+     * Root of the scalar function \ref g in the interval [\ref a, \ref b] bracketing a sign change, with \ref ga = g(
+     * \ref a ) and \ref gb = g( \ref b ), using the Illinois variant of the regula falsi. Returns the end of the final
+     * bracket on the side of \ref b, i.e., with the sign of \ref gb or zero */
+    template < typename T, typename functionType >
+    T findBracketedRoot( functionType g, T a, T b, T ga, T gb, const int maxIterations = 100 )
+    {
+      int side = 0;
+
+      for ( int i = 0; i < maxIterations && gb != 0; i++ ) {
+        if ( std::abs( b - a ) <= 4 * std::numeric_limits< T >::epsilon() * std::max( std::abs( a ), std::abs( b ) ) )
+          break;
+
+        const T c  = ( a * gb - b * ga ) / ( gb - ga );
+        const T gc = g( c );
+
+        if ( gc == 0 || ( gc > 0 ) == ( gb > 0 ) ) {
+          b  = c;
+          gb = gc;
+          // halve the weight of a retained end point to avoid the slow one sided convergence of the regula falsi
+          if ( side == 1 )
+            ga /= 2;
+          side = 1;
+        }
+        else {
+          a  = c;
+          ga = gc;
+          if ( side == -1 )
+            gb /= 2;
+          side = -1;
+        }
+      }
+
+      return b;
+    }
+
+    template < int ySize, typename T >
+    struct EventDetectionResult {
+      Eigen::Matrix< T, ySize, 1 > y;
+      T                            t;      ///< reached time, which is the time of the event if one was detected
+      T                            nextDt; ///< proposed size of a subsequent step
+      bool                         eventDetected;
+      bool                         converged;
+      int                          acceptedSteps;
+      int                          rejectedSteps;
+    };
+
+    /**
+     * Adaptive explicit Euler integration with Richardson extrapolation of function \ref fRate taking arguments
+     * \ref fRateArgs from the initial value \ref yN over the interval \ref deltaT , starting with the step size
+     * \ref dt, which stops exactly at the first sign change of the scalar \ref event function of the state, e.g., a
+     * yield function. A crossing within an accepted step is located on the step's cubic Hermite interpolant, hence the
+     * step is truncated without being repeated and without additional evaluations of \ref fRate; the rate at the end of
+     * an accepted step is reused for the next one. At the returned event state, \ref event has crossed, i.e., it is
+     * zero or has changed its sign
+     * */
+    template < int ySize, typename T, typename functionType, typename eventFunctionType, typename... Args >
+    EventDetectionResult< ySize, T > explicitEulerRichardsonWithEventDetection( const Eigen::Matrix< T, ySize, 1 >& yN,
+                                                                                const std::common_type_t< T > deltaT,
+                                                                                std::common_type_t< T >       dt,
+                                                                                const std::common_type_t< T > TOL,
+                                                                                functionType                  fRate,
+                                                                                eventFunctionType             event,
+                                                                                Args&&... fRateArgs )
+    {
+      MARMOT_PROFILE_SCOPE( "Math::explicitEulerRichardsonWithEventDetection" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+      typedef Eigen::Matrix< T, ySize, 1 > ySized;
+
+      EventDetectionResult< ySize, T > result{ yN, T( 0 ), dt, false, false, 0, 0 };
+
+      ySized f0 = fRate( yN, fRateArgs... );
+      T      g0 = event( yN );
+
+      while ( result.t < deltaT ) {
+        const T remainder = deltaT - result.t;
+        const T step      = std::min( dt, remainder );
+        if ( step <= 16 * std::numeric_limits< T >::epsilon() * deltaT )
+          return result;
+
+        ySized y1;
+        T      EST;
+        std::tie( y1, dt, EST ) = explicitEulerRichardsonStep< ySize >( result.y, f0, step, TOL, fRate, fRateArgs... );
+        if ( EST > TOL ) {
+          result.rejectedSteps++;
+          continue;
+        }
+
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+        const ySized f1 = fRate( y1, fRateArgs... );
+        const T      g1 = event( y1 );
+        result.acceptedSteps++;
+
+        if ( g0 != 0 && ( g1 == 0 || ( g1 > 0 ) != ( g0 > 0 ) ) ) {
+          const HermiteInterpolant< ySize, T > interpolant{ result.y, y1, f0, f1, step };
+
+          const T theta = findBracketedRoot( [&]( T theta_ ) { return event( interpolant( theta_ ) ); },
+                                             T( 0 ),
+                                             T( 1 ),
+                                             g0,
+                                             g1 );
+
+          result.y             = theta < 1 ? interpolant( theta ) : y1;
+          result.t             = theta < 1 ? result.t + theta * step : result.t + step;
+          result.nextDt        = dt;
+          result.eventDetected = true;
+          result.converged     = true;
+          return result;
+        }
+
+        result.y = y1;
+        result.t = step == remainder ? deltaT : result.t + step;
+        f0       = f1;
+        g0 = g1;
+      }
+
+      result.nextDt    = dt;
+      result.converged = true;
+      return result;
+    }
+
     /**
      * Computes the directional cosines between a transformed and the global cartesian coordinate system.
      */
@@ -273,5 +562,81 @@ namespace Marmot {
      * Computes an orthonormal coordinate system from two unit normal vectors as \f$ x_1 \f$ and \f$ x_2 \f$ - axis.
      */
     Matrix3d orthonormalCoordinateSystem( const Vector3d& n1, const Vector3d& n2 );
+
+    /**
+     * Computes the eigenvalues of a symmetric 3x3 matrix in ascending order using the closed-form trigonometric
+     * solution of the characteristic polynomial.
+     */
+    Vector3d eigenValuesSymmetric3x3( const Matrix3d& A );
+
+    /**
+     * Computes the eigenvalues (ascending) and the corresponding unit eigenvectors (columns) of a symmetric 3x3 matrix
+     * noniteratively, following Eberly (2014) A Robust Eigensolver for 3x3 Symmetric Matrices. Repeated eigenvalues
+     * yield an arbitrary orthonormal basis of the eigenspace.
+     */
+    std::pair< Vector3d, Matrix3d > eigenDecompositionSymmetric3x3( const Matrix3d& A );
+
+    /**
+     * Derivatives of the eigenvalues of a symmetric matrix with respect to the matrix, \f$ \frac{\partial
+     * \lambda_i}{\partial A_{kl}} = n_{k}^{(i)}\, n_{l}^{(i)} \f$, given the eigenvectors as columns. Row \f$ i \f$
+     * holds the column major flattened derivative of \f$ \lambda_i \f$. Valid for distinct eigenvalues.
+     */
+    Eigen::Matrix< double, 3, 9 > dEigenValues_dTensor( const Matrix3d& eigenVectors );
+
+    /**
+     * Lane-wise closed-form eigenvalues (ascending) of a batch of symmetric 3x3 matrices, branch-free and vectorized.
+     * In contrast to the scalar version, the input is not rescaled, i.e., entries beyond approx. 1e100 overflow.
+     */
+    template < int K >
+    BatchVector3d< K > eigenValuesSymmetric3x3( const BatchMatrix3d< K >& A )
+    {
+      using Lanes = typename BatchMatrix3d< K >::Lanes;
+
+      const Lanes q   = ( A( 0, 0 ) + A( 1, 1 ) + A( 2, 2 ) ) / 3.;
+      const Lanes b00 = A( 0, 0 ) - q, b11 = A( 1, 1 ) - q, b22 = A( 2, 2 ) - q;
+      const Lanes a01 = A( 0, 1 ), a02 = A( 0, 2 ), a12 = A( 1, 2 );
+
+      const Lanes p2 = ( b00.square() + b11.square() + b22.square() +
+                         2. * ( a01.square() + a02.square() + a12.square() ) ) /
+                       6.;
+      const Lanes p = p2.sqrt();
+
+      // det( B ) / 2 with B = ( A - q I ) / p, guarded for p = 0 (A = q I)
+      const Lanes det = b00 * ( b11 * b22 - a12.square() ) - a01 * ( a01 * b22 - a12 * a02 ) +
+                        a02 * ( a01 * a12 - b11 * a02 );
+      const Lanes invP3   = ( p2 * p ).max( std::numeric_limits< double >::min() ).inverse();
+      const Lanes halfDet = ( 0.5 * det * invP3 ).max( -1.0 ).min( 1.0 );
+      const Lanes angle   = halfDet.acos() / 3.;
+
+      constexpr double twoThirdsPi = 2. * Constants::Pi / 3.;
+
+      BatchVector3d< K > out( A.lanes() );
+      out( 2 ) = q + 2. * p * angle.cos();
+      out( 0 ) = q + 2. * p * ( angle + twoThirdsPi ).cos();
+      out( 1 ) = 3. * q - out( 0 ) - out( 2 );
+      return out;
+    }
+
+    /**
+     * Eigenvalues (ascending), eigenvectors and eigenvalue derivatives (\ref dEigenValues_dTensor) of a batch of
+     * symmetric 3x3 matrices, stored lane-wise for subsequent batched kernels.
+     */
+    template < int K >
+    std::tuple< BatchVector3d< K >, BatchMatrix3d< K >, Batch< Eigen::Matrix< double, 3, 9 >, K > >
+    eigenDecompositionSymmetric3x3( const BatchMatrix3d< K >& A )
+    {
+      BatchVector3d< K >                        values( A.lanes() );
+      BatchMatrix3d< K >                        vectors( A.lanes() );
+      Batch< Eigen::Matrix< double, 3, 9 >, K > derivatives( A.lanes() );
+
+      for ( Eigen::Index k = 0; k < A.lanes(); k++ ) {
+        const auto [lambda, N] = eigenDecompositionSymmetric3x3( A.get( k ) );
+        values.set( k, lambda );
+        vectors.set( k, N );
+        derivatives.set( k, dEigenValues_dTensor( N ) );
+      }
+
+      return { values, vectors, derivatives };
+    }
   } // namespace Math
 } // namespace Marmot
@@ -0,0 +1,173 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace Marmot {
+
+  /**
+   * Opt-in memoizing wrapper of an expensive function \ref f, keyed by the exact bits of the input. It is callable with
+   * the signature of \ref f, so it may be passed to every differentiation and integration routine accepting a
+   * std::function, e.g.,
+   *
+   *   MemoizedFunction< VectorXd, VectorXd > F( residual );
+   *   const VectorXd R = F( X );
+   *   const MatrixXd J = NumericalAlgorithms::Differentiation::forwardDifference( F, X ); // F( X ) is not evaluated
+   *
+   * Copies share the cache, which holds at most \ref capacity entries. It is a segmented LRU cache: entries which have
+   * been hit move into a protected segment of at most half the capacity, and misses replace the least recently used
+   * unprotected entry. Base points reused across calls thus outlive the one-shot evaluations at perturbed points.
+   * Inputs that compare equal but differ in their bits (e.g., +0. and -0.) are distinct keys; the scalar types double,
+   * std::complex< double > and dual produce distinct keys, too.
+   *
+   * Thread safety: the cache is not synchronized, keep one per thread like a Workspace, e.g., created within the
+   * material point update. It must be cleared whenever \ref f depends on state other than its input which changes. */
+  template < typename Output, typename Input >
+  class MemoizedFunction {
+
+  public:
+    using function_type = std::function< Output( const Input& ) >;
+
+    explicit MemoizedFunction( function_type f, int capacity = 8 )
+      : f( std::move( f ) ), cache( std::make_shared< Cache >() )
+    {
+      if ( capacity < 1 )
+        throw std::invalid_argument( "MemoizedFunction: capacity must be positive" );
+      cache->entries.reserve( capacity );
+      cache->capacity = capacity;
+    }
+
+    Output operator()( const Input& x ) const
+    {
+      const auto [bytes, nBytes] = bitsOf( x );
+      cache->clock++;
+
+      for ( Entry& entry : cache->entries ) {
+        const auto [entryBytes, nEntryBytes] = bitsOf( entry.input );
+        if ( nEntryBytes == nBytes && std::memcmp( entryBytes, bytes, nBytes ) == 0 ) {
+          if ( !entry.isProtected )
+            protect( entry );
+          entry.lastUse = cache->clock;
+          cache->hits++;
+          return entry.output;
+        }
+      }
+
+      cache->misses++;
+      Entry computed{ x, f( x ), cache->clock, false };
+
+      if ( static_cast< int >( cache->entries.size() ) < cache->capacity ) {
+        cache->entries.push_back( std::move( computed ) );
+        return cache->entries.back().output;
+      }
+
+      Entry* victim = leastRecentlyUsed( []( const Entry& entry ) { return !entry.isProtected; } );
+      if ( !victim )
+        victim = leastRecentlyUsed( []( const Entry& ) { return true; } );
+      *victim = std::move( computed );
+      return victim->output;
+    }
+
+    /// number of evaluations answered from the cache
+    long hits() const { return cache->hits; }
+
+    /// number of evaluations of the wrapped function
+    long misses() const { return cache->misses; }
+
+    void clear()
+    {
+      cache->entries.clear();
+      cache->clock  = 0;
+      cache->hits   = 0;
+      cache->misses = 0;
+    }
+
+  private:
+    struct Entry {
+      Input  input;
+      Output output;
+      long   lastUse;
+      bool   isProtected;
+    };
+
+    struct Cache {
+      std::vector< Entry > entries;
+      int                  capacity = 0;
+      long                 clock    = 0;
+      long                 hits     = 0;
+      long                 misses   = 0;
+    };
+
+    /**
+     * Least recently used entry satisfying \ref predicate, nullptr if there is none */
+    template < typename Predicate >
+    Entry* leastRecentlyUsed( Predicate predicate ) const
+    {
+      Entry* out = nullptr;
+      for ( Entry& entry : cache->entries )
+        if ( predicate( entry ) && ( !out || entry.lastUse < out->lastUse ) )
+          out = &entry;
+      return out;
+    }
+
+    /**
+     * Move \ref entry into the protected segment, which is bounded by half the capacity */
+    void protect( Entry& entry ) const
+    {
+      int nProtected = 0;
+      for ( const Entry& other : cache->entries )
+        nProtected += other.isProtected;
+
+      if ( 2 * ( nProtected + 1 ) > cache->capacity )
+        if ( Entry* oldest = leastRecentlyUsed( []( const Entry& other ) { return other.isProtected; } ) )
+          oldest->isProtected = false;
+
+      entry.isProtected = true;
+    }
+
+    static std::pair< const void*, size_t > bitsOf( const Input& x )
+    {
+      if constexpr ( std::is_base_of_v< Eigen::DenseBase< Input >, Input > )
+        return { x.data(), sizeof( typename Input::Scalar ) * x.size() };
+      else {
+        static_assert( std::is_trivially_copyable_v< Input >, "MemoizedFunction requires an Eigen or a trivial input" );
+        return { &x, sizeof( Input ) };
+      }
+    }
+
+    function_type            f;
+    std::shared_ptr< Cache > cache;
+  };
+
+} // namespace Marmot
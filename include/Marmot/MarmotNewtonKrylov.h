@@ -0,0 +1,99 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotAutomaticDifferentiation.h"
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include "Marmot/MarmotTypedefs.h"
+#include "Marmot/NewtonConvergenceChecker.h"
+#include <functional>
+
+namespace Marmot::NumericalAlgorithms::NewtonKrylov {
+
+  /**
+   * Matrix-free linear operator v -> A v */
+  using linear_operator_type = std::function< Eigen::VectorXd( const Eigen::VectorXd& v ) >;
+
+  /**
+   * Approximate inverse r -> M^-1 r of the preconditioner, e.g., the inverse diagonal or the factorized local block of
+   * the Jacobian; an empty function disables preconditioning */
+  using preconditioner_type = std::function< Eigen::VectorXd( const Eigen::VectorXd& r ) >;
+
+  struct GMRESOptions {
+    double relativeTolerance = 1e-4; ///< of the residual | b - A x | w.r.t. | b |, i.e., the forcing term in Newton
+    int    restart           = 30;   ///< dimension of the Krylov basis before restarting
+    int    maxIterations     = 300;
+  };
+
+  struct GMRESResult {
+    bool   converged;
+    double relativeResidual;
+    int    iterations;
+  };
+
+  /**
+   * Restarted GMRES for A \ref x = \ref b with the matrix-free operator \ref A, starting from the given \ref x, with
+   * optional right preconditioning so that the residual norm is not affected by the preconditioner. The Krylov basis
+   * and the Hessenberg matrix are drawn from the calling thread's Arena. Each iteration costs one application of \ref
+   * A, and of \ref preconditioner if provided. Besides the VectorXd returned by these applications, only a single
+   * argument vector for \ref A and \ref preconditioner is allocated per call */
+  GMRESResult gmres( const linear_operator_type&   A,
+                     const Eigen::VectorXd&        b,
+                     Eigen::Ref< Eigen::VectorXd > x,
+                     const GMRESOptions&           options        = {},
+                     const preconditioner_type&    preconditioner = {} );
+
+  struct NewtonKrylovResult {
+    Eigen::VectorXd X;
+    bool            converged;
+    int             newtonIterations;
+    int             krylovIterations;
+    int             residualEvaluations;
+  };
+
+  /**
+   * Jacobian-free Newton-Krylov solver for large local systems \ref F( X ) = 0, e.g., of gradient-enhanced or nonlocal
+   * formulations. The Newton corrections are computed inexactly by \ref gmres, with the Jacobian-vector products J v
+   * obtained by seeding the dual numbers of X along v (AutomaticDifferentiation::jvp), so that neither the Jacobian is
+   * formed nor a dense system is factorized. The cost scales with the number of Krylov iterations instead of the size
+   * of X. Convergence is decided by \ref checker. */
+  NewtonKrylovResult solve( const AutomaticDifferentiation::vector_to_vector_function_type_dual& F,
+                            const Eigen::VectorXd&                                              X0,
+                            const NewtonConvergenceChecker&                                     checker,
+                            const GMRESOptions&                                                 options = {},
+                            const preconditioner_type& preconditioner = {} );
+
+  /**
+   * Version of \ref solve computing the Jacobian-vector products by the complex step
+   * (Differentiation::Complex::forwardDifferenceJvp) for a residual \ref F accepting complex arguments */
+  NewtonKrylovResult solveComplexStep( const Differentiation::Complex::vector_to_vector_function_type& F,
+                                       const Eigen::VectorXd&                                          X0,
+                                       const NewtonConvergenceChecker&                                 checker,
+                                       const GMRESOptions&                                             options = {},
+                                       const preconditioner_type& preconditioner = {} );
+
+} // namespace Marmot::NumericalAlgorithms::NewtonKrylov
@@ -27,8 +27,11 @@
 
 #pragma once
 #include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotProfiling.h"
 #include "Marmot/MarmotTypedefs.h"
+#include "Marmot/MarmotWorkspace.h"
 #include <functional>
+#include <type_traits>
 
 namespace Marmot {
   namespace NumericalAlgorithms::Differentiation {
@@ -36,21 +39,149 @@ namespace Marmot {
     using scalar_to_scalar_function_type = std::function< double( const double x ) >;
     using vector_to_vector_function_type = std::function< Eigen::VectorXd( const Eigen::VectorXd& X ) >;
 
+    template < typename T >
+    using scalar_to_scalar_function_type_t = std::function< T( const T x ) >;
+    template < typename T >
+    using vector_to_vector_function_type_t = std::function< VectorXt< T >( const VectorXt< T >& X ) >;
+
     double forwardDifference( const scalar_to_scalar_function_type& f, const double x );
     double centralDifference( const scalar_to_scalar_function_type& f, const double x );
 
     Eigen::MatrixXd forwardDifference( const vector_to_vector_function_type& F, const Eigen::VectorXd& X );
     Eigen::MatrixXd centralDifference( const vector_to_vector_function_type& F, const Eigen::VectorXd& X );
 
+    /**
+     * Scalar type generic versions, e.g., forwardDifference< float >( F, X ), with step sizes derived from the machine
+     * epsilon of \ref T. Instantiated for float, double and long double */
+    template < typename T >
+    T forwardDifference( const scalar_to_scalar_function_type_t< T >& f, const T x );
+    template < typename T >
+    T centralDifference( const scalar_to_scalar_function_type_t< T >& f, const T x );
+
+    template < typename T >
+    MatrixXt< T > forwardDifference( const vector_to_vector_function_type_t< T >& F, const VectorXt< T >& X );
+    template < typename T >
+    MatrixXt< T > centralDifference( const vector_to_vector_function_type_t< T >& F, const VectorXt< T >& X );
+
+    /**
+     * Versions writing the Jacobian to \ref J, which must be of size X.size() x X.size() (e.g., a MatrixXd, a block of
+     * a larger matrix or a view of an Arena), using the scratch memory of the calling thread's \ref workspace, e.g.,
+     * forwardDifference< double >( F, X, J, workspace ); allocation free after the first call for a given size,
+     * besides the allocations of \ref F itself */
+    template < typename T >
+    void forwardDifference( const vector_to_vector_function_type_t< T >& F,
+                            const VectorXt< T >&                         X,
+                            Eigen::Ref< MatrixXt< T > >                  J,
+                            Workspace&                                   workspace );
+    template < typename T >
+    void centralDifference( const vector_to_vector_function_type_t< T >& F,
+                            const VectorXt< T >&                         X,
+                            Eigen::Ref< MatrixXt< T > >                  J,
+                            Workspace&                                   workspace );
+
+    /**
+     * Step size for a directional difference along \ref v, chosen such that the largest component of X is perturbed by
+     * \ref rootEps relative to max( 1, |X| ) */
+    template < typename T, typename DerivedX, typename DerivedV >
+    T directionalStepSize( const Eigen::MatrixBase< DerivedX >& X,
+                           const Eigen::MatrixBase< DerivedV >& v,
+                           const T                              rootEps )
+    {
+      const T h     = std::max( T( 1 ), T( X.template lpNorm< Eigen::Infinity >() ) ) * rootEps;
+      const T vNorm = v.template lpNorm< Eigen::Infinity >();
+      return vNorm > 0 ? h / vNorm : h;
+    }
+
+    /**
+     * Jacobian-vector products J v, i.e., the directional derivative of \ref F at \ref X along \ref v, at the cost of
+     * two evaluations of \ref F instead of N or 2N for the full Jacobian. The version with the given value \ref FX =
+     * F( X ), e.g., the residual of a Newton iteration, requires a single evaluation */
+    Eigen::VectorXd forwardDifferenceJvp( const vector_to_vector_function_type& F,
+                                          const Eigen::VectorXd&                X,
+                                          const Eigen::VectorXd&                v );
+    Eigen::VectorXd forwardDifferenceJvp( const vector_to_vector_function_type& F,
+                                          const Eigen::VectorXd&                X,
+                                          const Eigen::VectorXd&                FX,
+                                          const Eigen::VectorXd&                v );
+    Eigen::VectorXd centralDifferenceJvp( const vector_to_vector_function_type& F,
+                                          const Eigen::VectorXd&                X,
+                                          const Eigen::VectorXd&                v );
+
+    template < typename T >
+    VectorXt< T > forwardDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                        const VectorXt< T >&                         X,
+                                        const VectorXt< T >&                         v );
+    template < typename T >
+    VectorXt< T > forwardDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                        const VectorXt< T >&                         X,
+                                        const VectorXt< T >&                         FX,
+                                        const VectorXt< T >&                         v );
+    template < typename T >
+    VectorXt< T > centralDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                        const VectorXt< T >&                         X,
+                                        const VectorXt< T >&                         v );
+
+    /**
+     * Fixed size versions for a generic callable \ref F, e.g., centralDifferenceJvp( F, X, v ) for a Vector6d \ref X;
+     * no type erasure and no heap allocations */
+    template < typename functionType, int n, std::enable_if_t< ( n > 0 ), bool > = true >
+    auto forwardDifferenceJvp( const functionType&                  F,
+                               const Eigen::Matrix< double, n, 1 >& X,
+                               const Eigen::Matrix< double, n, 1 >& v )
+    {
+      MARMOT_PROFILE_SCOPE( "Differentiation::forwardDifferenceJvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 );
+
+      const double h = directionalStepSize( X, v, Constants::sqrtEps< double > );
+      return ( ( F( ( X + h * v ).eval() ) - F( X ) ) / h ).eval();
+    }
+
+    template < typename functionType, int n, typename DerivedFX, std::enable_if_t< ( n > 0 ), bool > = true >
+    auto forwardDifferenceJvp( const functionType&                  F,
+                               const Eigen::Matrix< double, n, 1 >& X,
+                               const Eigen::MatrixBase< DerivedFX >& FX,
+                               const Eigen::Matrix< double, n, 1 >& v )
+    {
+      MARMOT_PROFILE_SCOPE( "Differentiation::forwardDifferenceJvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+      const double h = directionalStepSize( X, v, Constants::sqrtEps< double > );
+      return ( ( F( ( X + h * v ).eval() ) - FX ) / h ).eval();
+    }
+
+    template < typename functionType, int n, std::enable_if_t< ( n > 0 ), bool > = true >
+    auto centralDifferenceJvp( const functionType&                  F,
+                               const Eigen::Matrix< double, n, 1 >& X,
+                               const Eigen::Matrix< double, n, 1 >& v )
+    {
+      MARMOT_PROFILE_SCOPE( "Differentiation::centralDifferenceJvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 );
+
+      const double h = directionalStepSize( X, v, Constants::cbrtEps< double > );
+      return ( ( F( ( X + h * v ).eval() ) - F( ( X - h * v ).eval() ) ) / ( 2 * h ) ).eval();
+    }
+
     namespace Complex {
 
-      const static std::complex< double > imaginaryUnit = { 0, 1 };
-      const static std::complex< double > complexUnit   = { 1, 1 };
-      const static std::complex< double > i_            = Marmot::Constants::sqrt2 / 2. * complexUnit;
+      constexpr std::complex< double > imaginaryUnit = { 0, 1 };
+      constexpr std::complex< double > complexUnit   = { 1, 1 };
+      constexpr std::complex< double > i_ = { Marmot::Constants::sqrt2 / 2., Marmot::Constants::sqrt2 / 2. };
 
       using scalar_to_scalar_function_type = std::function< complexDouble( const complexDouble x ) >;
       using vector_to_vector_function_type = std::function< Eigen::VectorXcd( const Eigen::VectorXcd& X ) >;
 
+      template < typename T >
+      using scalar_to_scalar_function_type_t = std::function< std::complex< T >( const std::complex< T > x ) >;
+      template < typename T >
+      using vector_to_vector_function_type_t = std::function< VectorXt< std::complex< T > >(
+        const VectorXt< std::complex< T > >& X ) >;
+
+      /**
+       * Imaginary step of the forward complex step approximation. It is free of subtractive cancellation, hence it may
+       * be chosen arbitrarily small for all precisions */
+      template < typename T >
+      constexpr T complexStep = T( 1e-20 );
+
       double forwardDifference( const scalar_to_scalar_function_type& f, const double x );
 
       std::tuple< Eigen::VectorXd, Eigen::MatrixXd > forwardDifference( const vector_to_vector_function_type& F,
@@ -61,6 +192,70 @@ namespace Marmot {
       Eigen::MatrixXd fourthOrderAccurateDerivative( const vector_to_vector_function_type& F,
                                                      const Eigen::VectorXd&                X );
 
+      template < typename T >
+      T forwardDifference( const scalar_to_scalar_function_type_t< T >& f, const T x );
+
+      template < typename T >
+      std::tuple< VectorXt< T >, MatrixXt< T > > forwardDifference( const vector_to_vector_function_type_t< T >& F,
+                                                                    const VectorXt< T >&                         X );
+
+      template < typename T >
+      MatrixXt< T > centralDifference( const vector_to_vector_function_type_t< T >& F, const VectorXt< T >& X );
+
+      template < typename T >
+      MatrixXt< T > fourthOrderAccurateDerivative( const vector_to_vector_function_type_t< T >& F,
+                                                   const VectorXt< T >&                         X );
+
+      /**
+       * Workspace versions, see the real valued counterparts */
+      template < typename T >
+      void forwardDifference( const vector_to_vector_function_type_t< T >& F,
+                              const VectorXt< T >&                         X,
+                              Eigen::Ref< VectorXt< T > >                  FX,
+                              Eigen::Ref< MatrixXt< T > >                  J,
+                              Workspace&                                   workspace );
+
+      template < typename T >
+      void centralDifference( const vector_to_vector_function_type_t< T >& F,
+                              const VectorXt< T >&                         X,
+                              Eigen::Ref< MatrixXt< T > >                  J,
+                              Workspace&                                   workspace );
+
+      template < typename T >
+      void fourthOrderAccurateDerivative( const vector_to_vector_function_type_t< T >& F,
+                                          const VectorXt< T >&                         X,
+                                          Eigen::Ref< MatrixXt< T > >                  J,
+                                          Workspace&                                   workspace );
+
+      /**
+       * Complex step Jacobian-vector product J v along the real direction \ref v, returning F( X ) and J v at the cost
+       * of a single evaluation of \ref F, free of subtractive cancellation */
+      std::tuple< Eigen::VectorXd, Eigen::VectorXd > forwardDifferenceJvp( const vector_to_vector_function_type& F,
+                                                                           const Eigen::VectorXd&                X,
+                                                                           const Eigen::VectorXd&                v );
+
+      template < typename T >
+      std::tuple< VectorXt< T >, VectorXt< T > > forwardDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                                                       const VectorXt< T >&                         X,
+                                                                       const VectorXt< T >&                         v );
+
+      /**
+       * Fixed size version for a generic callable \ref F accepting Eigen::Matrix< std::complex< double >, n, 1 > */
+      template < typename functionType, int n, std::enable_if_t< ( n > 0 ), bool > = true >
+      auto forwardDifferenceJvp( const functionType&                  F,
+                                 const Eigen::Matrix< double, n, 1 >& X,
+                                 const Eigen::Matrix< double, n, 1 >& v )
+      {
+        MARMOT_PROFILE_SCOPE( "Differentiation::Complex::forwardDifferenceJvp" );
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+        const double                               h   = complexStep< double >;
+        const Eigen::Matrix< complexDouble, n, 1 > X_  = X.template cast< complexDouble >() +
+                                                        complexDouble( 0, h ) * v.template cast< complexDouble >();
+        const auto                                 FX_ = F( X_ ).eval();
+        return std::make_tuple( FX_.real().eval(), ( FX_.imag() / h ).eval() );
+      }
+
     } // namespace Complex
   }   // namespace NumericalAlgorithms::Differentiation
 } // namespace Marmot
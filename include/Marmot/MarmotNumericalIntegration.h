@@ -28,17 +28,30 @@
 
 #pragma once
 #include <functional>
+#include <tuple>
 
 namespace Marmot {
   namespace NumericalAlgorithms::Integration {
 
     using scalar_to_scalar_function_type = std::function< double( const double x ) >;
 
+    template < typename T >
+    using scalar_to_scalar_function_type_t = std::function< T( const T x ) >;
+
     enum integrationRule { midpoint, trapezodial, simpson };
 
-    double integrateScalarFunction( scalar_to_scalar_function_type     f,
-                                    const std::tuple< double, double > integrationLimits,
-                                    const int                          n,
-                                    const integrationRule              intRule );
+    double integrateScalarFunction( const scalar_to_scalar_function_type& f,
+                                    const std::tuple< double, double >    integrationLimits,
+                                    const int                             n,
+                                    const integrationRule                 intRule );
+
+    /**
+     * Scalar type generic version, e.g., integrateScalarFunction< float >( ... ). Instantiated for float, double and
+     * long double */
+    template < typename T >
+    T integrateScalarFunction( const scalar_to_scalar_function_type_t< T >& f,
+                               const std::tuple< T, T >                     integrationLimits,
+                               const int                                    n,
+                               const integrationRule                        intRule );
   } // namespace NumericalAlgorithms::Integration
 } // namespace Marmot
@@ -0,0 +1,115 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+#include <vector>
+
+namespace Marmot::Math {
+
+  /**
+   * Precomputed direction cosines, rotation matrices and 6x6 Voigt transformation operators for a fixed set of
+   * orientations, e.g., the microplanes or the material axes of an anisotropic model. Build the table once per
+   * material and apply the batched rotate-in/rotate-out kernels per material point.
+   *
+   * Voigt notation follows Marmot's convention, i.e., (11, 22, 33, 12, 13, 23), with tensorial shear components for
+   * stresses and engineering (doubled) shear components for strains.
+   */
+  class OrientationTable {
+
+  public:
+    using Matrix6Xd = Eigen::Matrix< double, 6, Eigen::Dynamic >;
+
+    /**
+     * Build the table from orthonormal coordinate systems, with the local axes stored as columns */
+    explicit OrientationTable( const std::vector< Matrix3d >& coordinateSystems );
+
+    /**
+     * Build the table from unit normal vectors (columns) as local \f$ x_1 \f$ - axes, completed by
+     * \ref orthonormalCoordinateSystem */
+    static OrientationTable fromNormals( const Eigen::Matrix< double, 3, Eigen::Dynamic >& normals );
+
+    int size() const { return static_cast< int >( coordinateSystems.size() ); }
+
+    /**
+     * Local axes of orientation \ref i as columns, i.e., the rotation from local to global coordinates */
+    const Matrix3d& coordinateSystem( int i ) const { return coordinateSystems[i]; }
+
+    /**
+     * Direction cosines \f$ Q_{ij} = \boldsymbol{n}_i \cdot \boldsymbol{e}_j \f$ of orientation \ref i, i.e., the
+     * rotation from global to local coordinates */
+    const Matrix3d& directionCosines( int i ) const { return directionCosines_[i]; }
+
+    /**
+     * Voigt operator \f$ \boldsymbol{T}_\sigma \f$ of orientation \ref i, \f$ \sigma' = \boldsymbol{T}_\sigma \sigma
+     * \f$ */
+    auto stressTransformation( int i ) const { return stressTransformations.middleRows< 6 >( 6 * i ); }
+
+    /**
+     * Voigt operator \f$ \boldsymbol{T}_\varepsilon = \boldsymbol{T}_\sigma^{-T} \f$ of orientation \ref i, \f$
+     * \varepsilon' = \boldsymbol{T}_\varepsilon \varepsilon \f$ */
+    auto strainTransformation( int i ) const { return strainTransformations.middleRows< 6 >( 6 * i ); }
+
+    /**
+     * Rotate a global stress into all orientations at once; column \f$ i \f$ of \ref localStresses is the stress in
+     * orientation \f$ i \f$ */
+    void rotateStressIn( const Vector6d& globalStress, Matrix6Xd& localStresses ) const;
+    Matrix6Xd rotateStressIn( const Vector6d& globalStress ) const;
+
+    /**
+     * Rotate a global strain into all orientations at once */
+    void rotateStrainIn( const Vector6d& globalStrain, Matrix6Xd& localStrains ) const;
+    Matrix6Xd rotateStrainIn( const Vector6d& globalStrain ) const;
+
+    /**
+     * Rotate the local stresses of all orientations back to the global system and sum them with the given
+     * \ref weights, e.g., microplane integration weights */
+    Vector6d rotateStressOut( const Matrix6Xd& localStresses, const Eigen::VectorXd& weights ) const;
+
+    /**
+     * Rotate the local strains of all orientations back to the global system and sum them with the given
+     * \ref weights */
+    Vector6d rotateStrainOut( const Matrix6Xd& localStrains, const Eigen::VectorXd& weights ) const;
+
+  private:
+    std::vector< Matrix3d > coordinateSystems;
+    std::vector< Matrix3d > directionCosines_;
+
+    /// the 6x6 operators of all orientations stacked row-wise, so that rotating into all orientations is a single
+    /// matrix-vector product
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > stressTransformations;
+    Eigen::Matrix< double, Eigen::Dynamic, 6 > strainTransformations;
+  };
+
+  /**
+   * Voigt operator \f$ \boldsymbol{T}_\sigma \f$ for rotating stresses with the direction cosines \ref Q */
+  Matrix6d voigtStressTransformation( const Matrix3d& Q );
+
+  /**
+   * Voigt operator \f$ \boldsymbol{T}_\varepsilon \f$ for rotating strains with the direction cosines \ref Q */
+  Matrix6d voigtStrainTransformation( const Matrix3d& Q );
+
+} // namespace Marmot::Math
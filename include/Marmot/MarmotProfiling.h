@@ -0,0 +1,195 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+
+/**
+ * Opt-in instrumentation of the MathCore kernels. If MARMOT_ENABLE_PROFILING is not defined (the default), all
+ * macros expand to no-ops and nothing of this header is compiled.
+ *
+ * MARMOT_PROFILE_SCOPE( "name" ) times the enclosing block and counts its calls;
+ * MARMOT_PROFILE_COUNT_EVALUATIONS( n ) and Profiling::countAllocations( n ) attribute function evaluations and heap
+ * allocations to the innermost active scope of the calling thread.
+ *
+ * Counters are owned by the thread that writes them, so the hot path is free of locks and atomic read-modify-write
+ * operations; aggregation over threads happens only when a report is written.
+ */
+
+#ifdef MARMOT_ENABLE_PROFILING
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+namespace Marmot::Profiling {
+
+  /// maximum number of distinct region names
+  constexpr int maxRegions = 256;
+
+  /**
+   * Counters of a region for a single thread. Only the owning thread writes them, the atomics (relaxed) just make
+   * reads of the report functions from other threads well defined */
+  struct RegionCounters {
+    std::atomic< std::uint64_t > calls;
+    std::atomic< std::uint64_t > functionEvaluations;
+    std::atomic< std::uint64_t > allocations;
+    std::atomic< std::uint64_t > nanoseconds;
+  };
+
+  struct TraceEvent {
+    int           region;
+    std::int64_t  start;
+    std::uint64_t duration;
+  };
+
+  /**
+   * All counters of a thread, created on the thread's first profiled scope and kept until the end of the program */
+  struct ThreadRecord {
+    int                                      threadId;
+    std::array< RegionCounters, maxRegions > regions;
+    std::unique_ptr< TraceEvent[] >          trace;
+    std::size_t                              traceCapacity;
+    std::atomic< std::size_t >               traceSize;
+  };
+
+  inline thread_local ThreadRecord*   activeThread = nullptr;
+  inline thread_local RegionCounters* activeRegion = nullptr;
+
+  /**
+   * Returns the id for region \ref name, which must be a string literal; identical names share one id */
+  int registerRegion( const char* name );
+
+  /**
+   * Creates the record of the calling thread and sets \ref activeThread */
+  ThreadRecord& registerThread();
+
+  /**
+   * Records Chrome trace events of the next \ref eventsPerThread scopes of every thread registered after this call;
+   * call before the threads start profiling. Further events are dropped */
+  void enableTrace( std::size_t eventsPerThread );
+
+  /**
+   * Zeroes all counters and discards recorded trace events; not synchronized with running scopes */
+  void reset();
+
+  /**
+   * Writes the counters aggregated over all threads as JSON */
+  void writeJSON( std::ostream& out );
+
+  /**
+   * Writes the recorded trace events in the Chrome trace event format (chrome://tracing, Perfetto) */
+  void writeChromeTrace( std::ostream& out );
+
+  inline std::int64_t now()
+  {
+    return std::chrono::duration_cast< std::chrono::nanoseconds >(
+             std::chrono::steady_clock::now().time_since_epoch() )
+      .count();
+  }
+
+  inline void increment( std::atomic< std::uint64_t >& counter, std::uint64_t n )
+  {
+    counter.store( counter.load( std::memory_order_relaxed ) + n, std::memory_order_relaxed );
+  }
+
+  inline void countFunctionEvaluations( std::uint64_t n )
+  {
+    if ( activeRegion )
+      increment( activeRegion->functionEvaluations, n );
+  }
+
+  /**
+   * Attributes \ref n heap allocations to the active scope; does not allocate itself and may hence be called from a
+   * replaced operator new */
+  inline void countAllocations( std::uint64_t n )
+  {
+    if ( activeRegion )
+      increment( activeRegion->allocations, n );
+  }
+
+  /**
+   * RAII timer of a region, use via MARMOT_PROFILE_SCOPE */
+  class Scope {
+
+  public:
+    explicit Scope( int region )
+      : thread( activeThread ? *activeThread : registerThread() ),
+        counters( thread.regions[region] ),
+        parent( activeRegion ),
+        region( region ),
+        start( now() )
+    {
+      activeRegion = &counters;
+    }
+
+    ~Scope()
+    {
+      const std::uint64_t duration = now() - start;
+      increment( counters.calls, 1 );
+      increment( counters.nanoseconds, duration );
+
+      const std::size_t n = thread.traceSize.load( std::memory_order_relaxed );
+      if ( n < thread.traceCapacity ) {
+        thread.trace[n] = { region, start, duration };
+        thread.traceSize.store( n + 1, std::memory_order_release );
+      }
+
+      activeRegion = parent;
+    }
+
+    Scope( const Scope& )            = delete;
+    Scope& operator=( const Scope& ) = delete;
+
+  private:
+    ThreadRecord&      thread;
+    RegionCounters&    counters;
+    RegionCounters*    parent;
+    const int          region;
+    const std::int64_t start;
+  };
+
+} // namespace Marmot::Profiling
+
+#define MARMOT_PROFILE_CONCAT_( a, b ) a##b
+#define MARMOT_PROFILE_CONCAT( a, b ) MARMOT_PROFILE_CONCAT_( a, b )
+
+#define MARMOT_PROFILE_SCOPE( name )                                                                                 \
+  static const int MARMOT_PROFILE_CONCAT( marmotProfileRegion, __LINE__ ) = Marmot::Profiling::registerRegion( name ); \
+  const Marmot::Profiling::Scope MARMOT_PROFILE_CONCAT( marmotProfileScope,                                          \
+                                                        __LINE__ )( MARMOT_PROFILE_CONCAT( marmotProfileRegion, __LINE__ ) )
+
+#define MARMOT_PROFILE_COUNT_EVALUATIONS( n ) Marmot::Profiling::countFunctionEvaluations( n )
+
+#else
+
+#define MARMOT_PROFILE_SCOPE( name ) static_cast< void >( 0 )
+#define MARMOT_PROFILE_COUNT_EVALUATIONS( n ) static_cast< void >( 0 )
+
+#endif
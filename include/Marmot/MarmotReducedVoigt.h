@@ -0,0 +1,151 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+#include <array>
+
+namespace Marmot::ContinuumMechanics::ReducedVoigt {
+
+  /**
+   * Reduced stress states, computed natively with fewer than six Voigt components:
+   *  - twoDimensional: [ 11, 22, 12 ], a genuine two dimensional continuum;
+   *  - planeStrain and axisymmetric: [ 11, 22, 33, 12 ], with the out-of-plane or hoop component 33 and vanishing 13
+   *    and 23 components. */
+  enum class ReducedState { twoDimensional, planeStrain, axisymmetric };
+
+  /// number of Voigt components of \ref state
+  template < ReducedState state >
+  constexpr int voigtSize = state == ReducedState::twoDimensional ? 3 : 4;
+
+  /// number of normal components of \ref state, which precede the shear component
+  template < ReducedState state >
+  constexpr int nNormal = voigtSize< state > - 1;
+
+  template < ReducedState state, typename T = double >
+  using Vector = Eigen::Matrix< T, voigtSize< state >, 1 >;
+
+  template < ReducedState state, typename T = double >
+  using Matrix = Eigen::Matrix< T, voigtSize< state >, voigtSize< state > >;
+
+  /// positions of the reduced components in the Voigt vector [ 11, 22, 33, 12, 13, 23 ]
+  template < ReducedState state >
+  constexpr std::array< int, voigtSize< state > > positionIn3D()
+  {
+    if constexpr ( state == ReducedState::twoDimensional )
+      return { 0, 1, 3 };
+    else
+      return { 0, 1, 2, 3 };
+  }
+
+  /**
+   * Embed a reduced Voigt vector \ref v in the Voigt vector [ 11, 22, 33, 12, 13, 23 ]; missing components are zero */
+  template < ReducedState state, typename T >
+  Vector6t< T > expand( const Vector< state, T >& v )
+  {
+    constexpr auto position = positionIn3D< state >();
+    Vector6t< T >  out      = Vector6t< T >::Zero();
+    for ( int i = 0; i < voigtSize< state >; i++ )
+      out( position[i] ) = v( i );
+    return out;
+  }
+
+  /**
+   * Reduced components of the Voigt vector \ref v */
+  template < ReducedState state, typename T >
+  Vector< state, T > reduce( const Vector6t< T >& v )
+  {
+    constexpr auto     position = positionIn3D< state >();
+    Vector< state, T > out;
+    for ( int i = 0; i < voigtSize< state >; i++ )
+      out( i ) = v( position[i] );
+    return out;
+  }
+
+  /**
+   * Reduced rows and columns of a 6x6 Voigt matrix \ref C, e.g., of an algorithmic tangent */
+  template < ReducedState state, typename T >
+  Matrix< state, T > reduce( const Matrix6t< T >& C )
+  {
+    constexpr auto     position = positionIn3D< state >();
+    Matrix< state, T > out;
+    for ( int j = 0; j < voigtSize< state >; j++ )
+      for ( int i = 0; i < voigtSize< state >; i++ )
+        out( i, j ) = C( position[i], position[j] );
+    return out;
+  }
+
+  /**
+   * Second order identity in reduced Voigt notation */
+  template < ReducedState state, typename T = double >
+  Vector< state, T > identity()
+  {
+    Vector< state, T > out = Vector< state, T >::Zero();
+    out.template head< nNormal< state > >().setOnes();
+    return out;
+  }
+
+  /**
+   * Trace of the reduced stress \ref stress */
+  template < ReducedState state, typename T >
+  T trace( const Vector< state, T >& stress )
+  {
+    return stress.template head< nNormal< state > >().sum();
+  }
+
+  /**
+   * Deviatoric part of the reduced stress \ref stress, in \ref nNormal dimensions */
+  template < ReducedState state, typename T >
+  Vector< state, T > deviatoric( const Vector< state, T >& stress )
+  {
+    Vector< state, T > out = stress;
+    out.template head< nNormal< state > >().array() -= trace< state >( stress ) / T( nNormal< state > );
+    return out;
+  }
+
+  /**
+   * Deviatoric projector, i.e., deviatoric( stress ) = deviatoricProjector() * stress */
+  template < ReducedState state, typename T = double >
+  Matrix< state, T > deviatoricProjector()
+  {
+    Matrix< state, T > out = Matrix< state, T >::Identity();
+    out.template topLeftCorner< nNormal< state >, nNormal< state > >().array() -= T( 1 ) / T( nNormal< state > );
+    return out;
+  }
+
+  /**
+   * Second invariant \f$ J_2 = \frac{1}{2} s_{ij} s_{ij} \f$ of the deviator of the reduced stress \ref stress; the
+   * shear component enters twice */
+  template < ReducedState state, typename T >
+  T J2( const Vector< state, T >& stress )
+  {
+    const Vector< state, T > s     = deviatoric< state >( stress );
+    constexpr int            shear = nNormal< state >;
+    return T( 0.5 ) * s.template head< nNormal< state > >().squaredNorm() + s( shear ) * s( shear );
+  }
+
+} // namespace Marmot::ContinuumMechanics::ReducedVoigt
@@ -0,0 +1,321 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotBatch.h"
+#include "Marmot/MarmotTensor.h"
+#include "Marmot/MarmotTypedefs.h"
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace Marmot {
+  namespace ContinuumMechanics::StressInvariants {
+
+    /**
+     * Value of an invariant with its first and second derivatives with respect to the stress */
+    template < typename ValueType, typename GradientType, typename HessianType >
+    struct InvariantWithDerivatives {
+      ValueType    value;
+      GradientType dStress;
+      HessianType  d2Stress;
+    };
+
+    /**
+     * \f$ I_1 = \sigma_{ii} \f$, \f$ J_2 = \frac{1}{2} s_{ij} s_{ij} \f$, \f$ J_3 = \det s_{ij} \f$ and the Lode angle
+     * \f$ \theta = \frac{1}{3} \arccos \left( \frac{3 \sqrt{3}}{2} \frac{J_3}{J_2^{3/2}} \right) \in [0, \frac{\pi}{3}]
+     * \f$ with their derivatives */
+    template < typename ValueType, typename GradientType, typename HessianType >
+    struct StressInvariants {
+      using Invariant = InvariantWithDerivatives< ValueType, GradientType, HessianType >;
+
+      Invariant I1;
+      Invariant J2;
+      Invariant J3;
+      Invariant lodeAngle;
+    };
+
+    template < typename T >
+    using VoigtStressInvariants = StressInvariants< T, Vector6t< T >, Matrix6t< T > >;
+
+    template < typename T >
+    using TensorStressInvariants = StressInvariants< T, Matrix3t< T >, EigenTensors::Tensor3333t< T > >;
+
+    template < typename T, int K >
+    using BatchStressInvariants = StressInvariants< typename Batch< Vector6t< T >, K >::Lanes,
+                                                    Batch< Vector6t< T >, K >,
+                                                    Batch< Matrix6t< T >, K > >;
+
+    /**
+     * Operations for both scalars and all lanes of a Batch coefficient */
+    namespace LaneOperations {
+
+      template < typename T, typename = std::enable_if_t< std::is_arithmetic< T >::value > >
+      T maximum( const T a, const T b )
+      {
+        return a > b ? a : b;
+      }
+
+      template < typename Derived >
+      auto maximum( const Eigen::ArrayBase< Derived >& a, const typename Derived::Scalar b )
+      {
+        return a.max( b );
+      }
+
+      template < typename T, typename = std::enable_if_t< std::is_arithmetic< T >::value > >
+      T clampUnit( const T a )
+      {
+        return a < -1 ? T( -1 ) : a > 1 ? T( 1 ) : a;
+      }
+
+      template < typename Derived >
+      auto clampUnit( const Eigen::ArrayBase< Derived >& a )
+      {
+        return a.max( typename Derived::Scalar( -1 ) ).min( typename Derived::Scalar( 1 ) );
+      }
+
+      template < typename T, typename = std::enable_if_t< std::is_arithmetic< T >::value > >
+      T selectIfPositive( const T condition, const T value )
+      {
+        return condition > 0 ? value : T( 0 );
+      }
+
+      template < typename DerivedCondition, typename DerivedValue >
+      auto selectIfPositive( const Eigen::ArrayBase< DerivedCondition >& condition,
+                             const Eigen::ArrayBase< DerivedValue >&     value )
+      {
+        return ( condition > 0 ).select( value, typename DerivedValue::Scalar( 0 ) );
+      }
+
+    } // namespace LaneOperations
+
+    /**
+     * Fused kernel for a Voigt stress \f$ [\sigma_{11}, \sigma_{22}, \sigma_{33}, \sigma_{12}, \sigma_{13},
+     * \sigma_{23}] \f$, shared by the scalar and the lane-wise (Batch) versions; \ref Value is the scalar or the lanes
+     * type */
+    template < typename T, typename Value, typename StressType, typename Invariants >
+    void computeVoigt( const StressType& stress, Invariants& out )
+    {
+      using namespace LaneOperations;
+      using std::acos;
+      using std::sqrt;
+
+      const Value p   = ( stress( 0 ) + stress( 1 ) + stress( 2 ) ) / T( 3 );
+      const Value s11 = stress( 0 ) - p;
+      const Value s22 = stress( 1 ) - p;
+      const Value s33 = stress( 2 ) - p;
+      const Value s12 = stress( 3 );
+      const Value s13 = stress( 4 );
+      const Value s23 = stress( 5 );
+
+      // I1
+      out.I1.value = T( 3 ) * p;
+      for ( int i = 0; i < 6; i++ )
+        out.I1.dStress( i ) = T( i < 3 ? 1 : 0 );
+      out.I1.d2Stress.setZero();
+
+      // J2
+      out.J2.value = T( 0.5 ) * ( s11 * s11 + s22 * s22 + s33 * s33 ) + s12 * s12 + s13 * s13 + s23 * s23;
+
+      out.J2.dStress( 0 ) = s11;
+      out.J2.dStress( 1 ) = s22;
+      out.J2.dStress( 2 ) = s33;
+      out.J2.dStress( 3 ) = T( 2 ) * s12;
+      out.J2.dStress( 4 ) = T( 2 ) * s13;
+      out.J2.dStress( 5 ) = T( 2 ) * s23;
+
+      out.J2.d2Stress.setZero();
+      for ( int i = 0; i < 3; i++ ) {
+        for ( int j = 0; j < 3; j++ )
+          out.J2.d2Stress( i, j ) = T( i == j ? 2. / 3 : -1. / 3 );
+        out.J2.d2Stress( i + 3, i + 3 ) = T( 2 );
+      }
+
+      // J3 from the cofactors of the deviator
+      const Value c11 = s22 * s33 - s23 * s23;
+      const Value c22 = s11 * s33 - s13 * s13;
+      const Value c33 = s11 * s22 - s12 * s12;
+      const Value c12 = s13 * s23 - s33 * s12;
+      const Value c13 = s12 * s23 - s22 * s13;
+      const Value c23 = s12 * s13 - s11 * s23;
+      const Value cm  = ( c11 + c22 + c33 ) / T( 3 );
+
+      out.J3.value = s11 * c11 + s12 * c12 + s13 * c13;
+
+      out.J3.dStress( 0 ) = c11 - cm;
+      out.J3.dStress( 1 ) = c22 - cm;
+      out.J3.dStress( 2 ) = c33 - cm;
+      out.J3.dStress( 3 ) = T( 2 ) * c12;
+      out.J3.dStress( 4 ) = T( 2 ) * c13;
+      out.J3.dStress( 5 ) = T( 2 ) * c23;
+
+      // Hessian of the determinant with respect to the deviator components, projected onto the deviatoric space for
+      // the normal components: [ P Hdd P, P Hdo ; Hdo^T P, Hoo ] with P = I - 1/3 ones, Hdd = [ 0, s33, s22 ; s33, 0,
+      // s11 ; s22, s11, 0 ] and Hdo = [ 0, 0, -2 s23 ; 0, -2 s13, 0 ; -2 s12, 0, 0 ]
+      const Value rowMean[3] = { ( s22 + s33 ) / T( 3 ), ( s11 + s33 ) / T( 3 ), ( s11 + s22 ) / T( 3 ) };
+      const Value mean       = T( 2 ) * ( s11 + s22 + s33 ) / T( 9 );
+      for ( int i = 0; i < 3; i++ )
+        out.J3.d2Stress( i, i ) = mean - T( 2 ) * rowMean[i];
+      out.J3.d2Stress( 0, 1 ) = out.J3.d2Stress( 1, 0 ) = s33 - rowMean[0] - rowMean[1] + mean;
+      out.J3.d2Stress( 0, 2 ) = out.J3.d2Stress( 2, 0 ) = s22 - rowMean[0] - rowMean[2] + mean;
+      out.J3.d2Stress( 1, 2 ) = out.J3.d2Stress( 2, 1 ) = s11 - rowMean[1] - rowMean[2] + mean;
+
+      const Value shear[3] = { s12, s13, s23 };
+      for ( int i = 0; i < 3; i++ )
+        for ( int j = 0; j < 3; j++ )
+          out.J3.d2Stress( i, j + 3 ) = out.J3.d2Stress( j + 3, i ) = T( i + j == 2 ? -4. / 3 : 2. / 3 ) * shear[j];
+
+      out.J3.d2Stress( 3, 3 ) = T( -2 ) * s33;
+      out.J3.d2Stress( 4, 4 ) = T( -2 ) * s22;
+      out.J3.d2Stress( 5, 5 ) = T( -2 ) * s11;
+      out.J3.d2Stress( 3, 4 ) = out.J3.d2Stress( 4, 3 ) = T( 2 ) * s23;
+      out.J3.d2Stress( 3, 5 ) = out.J3.d2Stress( 5, 3 ) = T( 2 ) * s13;
+      out.J3.d2Stress( 4, 5 ) = out.J3.d2Stress( 5, 4 ) = T( 2 ) * s12;
+
+      // Lode angle; its derivatives vanish where they are undefined, i.e., for J2 = 0 and on the meridians
+      const T     k       = T( 1.5 ) * std::sqrt( T( 3 ) );
+      const Value J2      = maximum( out.J2.value, std::pow( std::numeric_limits< T >::min(), T( 0.25 ) ) );
+      const Value J2m32   = T( 1 ) / ( J2 * sqrt( J2 ) );
+      const Value J2m52   = J2m32 / J2;
+      const Value r       = clampUnit( k * out.J3.value * J2m32 );
+      const Value a       = T( 1 ) - r * r;
+      const Value sqrtA   = sqrt( maximum( a, T( 0 ) ) );
+      const Value f1      = selectIfPositive( out.J2.value * a, T( -1 ) / ( T( 3 ) * sqrtA ) );
+      const Value f2      = f1 * r / maximum( a, std::numeric_limits< T >::min() );
+      const Value cJ2J2   = T( 3.75 ) * k * out.J3.value * J2m52 / J2;
+      const Value cJ2J3   = T( -1.5 ) * k * J2m52;
+      out.lodeAngle.value = acos( r ) / T( 3 );
+
+      // dr = k ( J2^-3/2 dJ3 - 3/2 J3 J2^-5/2 dJ2 ) is kept in the Lode angle gradient until the Hessian is assembled
+      for ( int i = 0; i < 6; i++ )
+        out.lodeAngle.dStress( i ) = k * J2m32 * out.J3.dStress( i ) + cJ2J3 * out.J3.value * out.J2.dStress( i );
+
+      for ( int i = 0; i < 6; i++ )
+        for ( int j = 0; j < 6; j++ )
+          out.lodeAngle.d2Stress( i, j ) = f1 * ( k * J2m32 * out.J3.d2Stress( i, j ) +
+                                                  cJ2J3 * ( out.J3.dStress( i ) * out.J2.dStress( j ) +
+                                                            out.J2.dStress( i ) * out.J3.dStress( j ) +
+                                                            out.J3.value * out.J2.d2Stress( i, j ) ) +
+                                                  cJ2J2 * out.J2.dStress( i ) * out.J2.dStress( j ) ) +
+                                           f2 * out.lodeAngle.dStress( i ) * out.lodeAngle.dStress( j );
+
+      for ( int i = 0; i < 6; i++ )
+        out.lodeAngle.dStress( i ) *= f1;
+    }
+
+    /**
+     * \f$ I_1 \f$, \f$ J_2 \f$, \f$ J_3 \f$ and the Lode angle of a Voigt stress \f$ [\sigma_{11}, \sigma_{22},
+     * \sigma_{33}, \sigma_{12}, \sigma_{13}, \sigma_{23}] \f$ with their gradients and Hessians with respect to the
+     * Voigt components in a single pass; the shear components enter the invariants twice, e.g., \f$ \frac{\partial
+     * J_2}{\partial \sigma_{12}} = 2 \sigma_{12} \f$ */
+    template < typename T >
+    VoigtStressInvariants< T > invariants( const Vector6t< T >& stress )
+    {
+      VoigtStressInvariants< T > out;
+      computeVoigt< T, T >( stress, out );
+      return out;
+    }
+
+    /**
+     * Lane-wise version for \ref K Voigt stresses, vectorized across the lanes */
+    template < typename T, int K >
+    BatchStressInvariants< T, K > invariants( const Batch< Vector6t< T >, K >& stress )
+    {
+      BatchStressInvariants< T, K > out;
+      for ( auto* invariant : { &out.I1, &out.J2, &out.J3, &out.lodeAngle } ) {
+        invariant->dStress.data.resize( stress.lanes(), 6 );
+        invariant->d2Stress.data.resize( stress.lanes(), 36 );
+      }
+      computeVoigt< T, typename Batch< Vector6t< T >, K >::Lanes >( stress, out );
+      return out;
+    }
+
+    /**
+     * \f$ I_1 \f$, \f$ J_2 \f$, \f$ J_3 \f$ and the Lode angle of a symmetric stress tensor with their derivatives with
+     * respect to the tensor components; the Hessian of \f$ J_2 \f$ is
+     * CommonTensors::dDeviatoricStress_dStress, and the Hessians are, like the latter, not symmetrized in the index
+     * pairs */
+    template < typename T >
+    TensorStressInvariants< T > invariants( const Matrix3t< T >& stress )
+    {
+      using TensorUtility::d;
+
+      TensorStressInvariants< T > out;
+
+      const T           p = stress.trace() / 3;
+      const Matrix3t< T > s = stress - p * Matrix3t< T >::Identity();
+
+      out.I1.value   = 3 * p;
+      out.I1.dStress = Matrix3t< T >::Identity();
+      out.I1.d2Stress.setZero();
+
+      out.J2.value    = T( 0.5 ) * s.cwiseProduct( s ).sum();
+      out.J2.dStress  = s;
+      out.J2.d2Stress = CommonTensors::dDeviatoricStress_dStress.template cast< T >();
+
+      out.J3.value   = s.determinant();
+      out.J3.dStress = s * s - T( 2. / 3 ) * out.J2.value * Matrix3t< T >::Identity();
+      for ( int k = 0; k < 3; k++ )
+        for ( int l = 0; l < 3; l++ )
+          for ( int m = 0; m < 3; m++ )
+            for ( int n = 0; n < 3; n++ )
+              out.J3.d2Stress( k, l, m, n ) = d( k, m ) * s( n, l ) + s( k, m ) * d( l, n ) -
+                                              T( 2. / 3 ) * ( d( m, n ) * s( k, l ) + d( k, l ) * s( m, n ) );
+
+      // Lode angle; its derivatives vanish where they are undefined, i.e., for J2 = 0 and on the meridians
+      const T k     = T( 1.5 ) * std::sqrt( T( 3 ) );
+      const T J2    = std::max( out.J2.value, std::pow( std::numeric_limits< T >::min(), T( 0.25 ) ) );
+      const T J2m32 = 1 / ( J2 * std::sqrt( J2 ) );
+      const T J2m52 = J2m32 / J2;
+      const T r     = std::min( T( 1 ), std::max( T( -1 ), k * out.J3.value * J2m32 ) );
+      const T a     = 1 - r * r;
+      const T f1    = out.J2.value > 0 && a > 0 ? -1 / ( 3 * std::sqrt( a ) ) : T( 0 );
+      const T f2    = f1 * r / std::max( a, std::numeric_limits< T >::min() );
+      const T cJ2J2 = T( 3.75 ) * k * out.J3.value * J2m52 / J2;
+      const T cJ2J3 = T( -1.5 ) * k * J2m52;
+
+      const Matrix3t< T > dr = k * J2m32 * out.J3.dStress + cJ2J3 * out.J3.value * out.J2.dStress;
+
+      out.lodeAngle.value   = std::acos( r ) / 3;
+      out.lodeAngle.dStress = f1 * dr;
+      for ( int k_ = 0; k_ < 3; k_++ )
+        for ( int l = 0; l < 3; l++ )
+          for ( int m = 0; m < 3; m++ )
+            for ( int n = 0; n < 3; n++ ) {
+              const T d2r = k * J2m32 * out.J3.d2Stress( k_, l, m, n ) +
+                            cJ2J3 * ( out.J3.dStress( k_, l ) * out.J2.dStress( m, n ) +
+                                      out.J2.dStress( k_, l ) * out.J3.dStress( m, n ) +
+                                      out.J3.value * out.J2.d2Stress( k_, l, m, n ) ) +
+                            cJ2J2 * out.J2.dStress( k_, l ) * out.J2.dStress( m, n );
+              out.lodeAngle.d2Stress( k_, l, m, n ) = f1 * d2r + f2 * dr( k_, l ) * dr( m, n );
+            }
+
+      return out;
+    }
+
+  } // namespace ContinuumMechanics::StressInvariants
+} // namespace Marmot
@@ -0,0 +1,160 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotMath.h"
+#include <array>
+#include <vector>
+
+namespace Marmot {
+  namespace Math {
+
+    /**
+     * Tabulated curve y( x ), e.g., a hardening or softening curve given by pairs of values.
+     *
+     * The interval of a query point is found in O( 1 ) for uniform grids, and by a branch-free binary search for
+     * non-uniform grids. Between the grid points, the curve is interpolated linearly or by monotone cubic Hermite
+     * polynomials (Fritsch and Carlson, 1980), which preserve the monotonicity of the data and do not overshoot. The
+     * derivative dy/dx is analytic. Evaluation is generic in the scalar type, e.g., double, dual or complex, so that
+     * the curve composes with automatic and complex step differentiation; the interval is selected by the real part.
+     *
+     * Beyond the table, the curve is continued by the end values (constant) or by the end slopes (linear).
+     */
+    class TabulatedFunction {
+
+    public:
+      enum class Interpolation { linear, monotoneCubic };
+      enum class Extrapolation { constant, linear };
+
+      /**
+       * Non-uniform grid of strictly increasing points \ref x with values \ref y */
+      TabulatedFunction( std::vector< double > x,
+                         std::vector< double > y,
+                         Interpolation         interpolation = Interpolation::linear,
+                         Extrapolation         extrapolation = Extrapolation::constant );
+
+      /**
+       * Uniform grid x_i = \ref x0 + i \ref dx with values \ref y */
+      static TabulatedFunction uniform( double                x0,
+                                        double                dx,
+                                        std::vector< double > y,
+                                        Interpolation         interpolation = Interpolation::linear,
+                                        Extrapolation         extrapolation = Extrapolation::constant );
+
+      /**
+       * Value at \ref x */
+      template < typename Scalar >
+      Scalar operator()( const Scalar& x ) const
+      {
+        const double xReal = makeReal( x );
+        if ( xReal < x_.front() || xReal > x_.back() ) {
+          const size_t end = xReal < x_.front() ? 0 : x_.size() - 1;
+          if ( extrapolation == Extrapolation::linear )
+            return y_[end] + slopes[end] * ( x - x_[end] );
+          return Scalar( y_[end] );
+        }
+
+        const size_t                   i = interval( xReal );
+        const std::array< double, 4 >& c = coefficients[i];
+        const Scalar                   u = x - x_[i];
+        return c[0] + u * ( c[1] + u * ( c[2] + u * c[3] ) );
+      }
+
+      /**
+       * Analytic derivative dy/dx at \ref x */
+      template < typename Scalar >
+      Scalar derivative( const Scalar& x ) const
+      {
+        const double xReal = makeReal( x );
+        if ( xReal < x_.front() || xReal > x_.back() ) {
+          const size_t end = xReal < x_.front() ? 0 : x_.size() - 1;
+          return Scalar( extrapolation == Extrapolation::linear ? slopes[end] : 0. );
+        }
+
+        const size_t                   i = interval( xReal );
+        const std::array< double, 4 >& c = coefficients[i];
+        const Scalar                   u = x - x_[i];
+        return c[1] + u * ( 2. * c[2] + 3. * c[3] * u );
+      }
+
+      /**
+       * Values at an array of query points \ref x, e.g., the lanes of a Batch */
+      template < typename Derived >
+      Eigen::Array< typename Derived::Scalar, Derived::SizeAtCompileTime, 1 > evaluate(
+        const Eigen::ArrayBase< Derived >& x ) const
+      {
+        Eigen::Array< typename Derived::Scalar, Derived::SizeAtCompileTime, 1 > out( x.size() );
+        for ( Eigen::Index k = 0; k < x.size(); k++ )
+          out( k ) = ( *this )( x( k ) );
+        return out;
+      }
+
+      /**
+       * Derivatives at an array of query points \ref x */
+      template < typename Derived >
+      Eigen::Array< typename Derived::Scalar, Derived::SizeAtCompileTime, 1 > evaluateDerivative(
+        const Eigen::ArrayBase< Derived >& x ) const
+      {
+        Eigen::Array< typename Derived::Scalar, Derived::SizeAtCompileTime, 1 > out( x.size() );
+        for ( Eigen::Index k = 0; k < x.size(); k++ )
+          out( k ) = derivative( x( k ) );
+        return out;
+      }
+
+    private:
+      std::vector< double >                  x_;
+      std::vector< double >                  y_;
+      /// slopes dy/dx at the grid points
+      std::vector< double >                  slopes;
+      /// coefficients of the polynomial in ( x - x_i ) of each interval
+      std::vector< std::array< double, 4 > > coefficients;
+      Extrapolation                          extrapolation;
+      bool                                   isUniform = false;
+      double                                 inverseDx = 0;
+
+      /**
+       * Index i of the interval [ x_i, x_i+1 ) containing \ref xReal within the table; the last interval is closed */
+      size_t interval( double xReal ) const
+      {
+        const size_t nIntervals = x_.size() - 1;
+        if ( isUniform )
+          return std::min( static_cast< size_t >( ( xReal - x_.front() ) * inverseDx ), nIntervals - 1 );
+
+        // branch-free lower bound: the comparison compiles to a conditional move
+        const double* base = x_.data();
+        size_t        n    = nIntervals;
+        while ( n > 1 ) {
+          const size_t half = n / 2;
+          base              = base[half] <= xReal ? base + half : base;
+          n -= half;
+        }
+        return base - x_.data();
+      }
+    };
+
+  } // namespace Math
+} // namespace Marmot
@@ -0,0 +1,71 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include "Marmot/MarmotTypedefs.h"
+
+namespace Marmot::NumericalAlgorithms::TangentVerification {
+
+  struct StochasticCheckOptions {
+    /// number of random probe directions k; a wrong tangent is missed with probability at most 2^-k
+    int nProbes = 4;
+    /// admissible deviation of J v from the directional difference, relative to the larger of both
+    double relativeTolerance = 1e-5;
+    /// seed of the probe directions, e.g., the element and integration point number for reproducibility
+    unsigned int seed = 0;
+  };
+
+  struct StochasticCheckResult {
+    bool   passed;
+    double maximumRelativeError;
+    /// upper bound of the probability that a wrong tangent passed, 2^-nProbes
+    double missProbability;
+    int    nEvaluations;
+  };
+
+  /**
+   * Probabilistic verification of the tangent \ref J of \ref F at \ref X in O( 1 ) evaluations of \ref F, e.g., for a
+   * sampled subset of integration points in production runs. For each of the random Rademacher directions v (entries
+   * +-1), J v is compared against the central directional difference ( F( X + h v ) - F( X - h v ) ) / 2h at a cost of
+   * two evaluations. If a row of \ref J is wrong, each probe detects it with probability of at least 1/2 (up to the
+   * tolerance), hence k probes miss it with probability of at most 2^-k, independently of the size of \ref X. A full
+   * finite difference Jacobian requires 2 N evaluations instead. */
+  StochasticCheckResult checkTangent( const Differentiation::vector_to_vector_function_type& F,
+                                      const Eigen::VectorXd&                                 X,
+                                      const Eigen::MatrixXd&                                 J,
+                                      const StochasticCheckOptions&                          options = {} );
+
+  /**
+   * Complex step version of \ref checkTangent, free of subtractive cancellation and at a cost of one evaluation per
+   * probe, for a function \ref F accepting complex arguments */
+  StochasticCheckResult checkTangentComplexStep( const Differentiation::Complex::vector_to_vector_function_type& F,
+                                                 const Eigen::VectorXd&                                          X,
+                                                 const Eigen::MatrixXd&                                          J,
+                                                 const StochasticCheckOptions& options = {} );
+
+} // namespace Marmot::NumericalAlgorithms::TangentVerification
@@ -30,6 +30,7 @@
 #include "Marmot/MarmotTypedefs.h"
 #include "Marmot/MarmotVoigt.h"
 #include <iostream>
+#include <type_traits>
 #include <utility>
 
 namespace Marmot {
@@ -44,6 +45,24 @@ namespace Marmot {
     extern const EigenTensors::Tensor333d LeviCivita3D;
     extern const EigenTensors::Tensor122d LeviCivita2D;
 
+    /**
+     * The common fourth order tensors of dimension \ref nDim, e.g., OfDimension< 2 >::Isym as Tensor2222d, for models
+     * computing natively in 2D. Instantiated for nDim = 2 and 3. The deviatoric projector refers to the deviator in
+     * \ref nDim dimensions; plane strain and axisymmetric states, which carry an out-of-plane normal component, are
+     * covered by the four component Voigt kernels in ContinuumMechanics::ReducedVoigt */
+    template < int nDim >
+    struct OfDimension {
+      static const EigenTensors::TensorNNNN< nDim > I2xI2;
+      static const EigenTensors::TensorNNNN< nDim > Isym;
+      static const EigenTensors::TensorNNNN< nDim > Iskew;
+      static const EigenTensors::TensorNNNN< nDim > IFourthOrder;
+      static const EigenTensors::TensorNNNN< nDim > IFourthOrderTranspose;
+      static const EigenTensors::TensorNNNN< nDim > dDeviatoricStress_dStress;
+    };
+
+    extern template struct OfDimension< 2 >;
+    extern template struct OfDimension< 3 >;
+
     constexpr int getNumberOfDofForRotation( int nDim )
     {
       if ( nDim == 2 )
@@ -109,38 +128,152 @@ namespace Marmot {
       return a == b ? 1 : 0;
     }
 
+    /**
+     * Number of scalar entries of a fixed size Eigen::Matrix, Eigen::Map or Eigen::TensorFixedSize, or Eigen::Dynamic
+     * if unknown at compile time */
+    template < typename T, typename = void >
+    struct CompileTimeSize : std::integral_constant< int, T::SizeAtCompileTime > {
+    };
+
+    template < typename T >
+    struct CompileTimeSize< T, std::void_t< decltype( T::Dimensions::total_size ) > >
+      : std::integral_constant< int, static_cast< int >( T::Dimensions::total_size ) > {
+    };
+
+    /**
+     * Check if the entries of \ref T are stored contiguously (no inner or outer gaps), which is required for
+     * reinterpreting the storage with a different shape */
+    template < typename T, typename = void >
+    struct IsContiguous
+      : std::bool_constant< T::InnerStrideAtCompileTime == 1 &&
+                            T::OuterStrideAtCompileTime ==
+                              ( T::IsRowMajor ? T::ColsAtCompileTime : T::RowsAtCompileTime ) > {
+    };
+
+    template < typename T >
+    struct IsContiguous< T, std::void_t< decltype( T::Dimensions::total_size ) > > : std::true_type {
+    };
+
+    /**
+     * Check if the storage order of \ref T is compatible with the column major layout of Eigen::Matrix and
+     * Eigen::Tensor. Vectors are always compatible */
+    template < typename T, typename = void >
+    struct IsColumnMajor
+      : std::bool_constant< !T::IsRowMajor || T::RowsAtCompileTime == 1 || T::ColsAtCompileTime == 1 > {
+    };
+
+    template < typename T >
+    struct IsColumnMajor< T, std::void_t< decltype( T::Dimensions::total_size ) > >
+      : std::bool_constant< static_cast< int >( T::Layout ) == static_cast< int >( Eigen::ColMajor ) > {
+    };
+
+    template < typename T, int size >
+    constexpr void checkReinterpretable()
+    {
+      using Plain = std::remove_const_t< std::remove_reference_t< T > >;
+      static_assert( CompileTimeSize< Plain >::value == Eigen::Dynamic || CompileTimeSize< Plain >::value == size,
+                     "size of the mapped object does not match the requested shape" );
+      static_assert( IsContiguous< Plain >::value, "only contiguous storage can be reinterpreted" );
+      static_assert( IsColumnMajor< Plain >::value, "only column major storage can be reinterpreted" );
+    }
+
+    /**
+     * Map a contiguous, column major Eigen::Matrix or Eigen::TensorFixedSize as Eigen::Matrix of size \ref x
+     * times \ref y without copying, e.g., a Tensor3333d as Matrix9d */
     template < int x,
                int y,
                typename T,
                typename = std::enable_if< !std::is_const< std::remove_reference< T > >::value > >
     auto as( T& t )
     {
+      checkReinterpretable< T, x * y >();
       return Eigen::Map< Eigen::Matrix< typename T::Scalar, x, y > >( t.data() );
     }
 
     template < int x, int y, typename T, typename = void >
     auto as( const T& t )
     {
+      checkReinterpretable< T, x * y >();
       return Eigen::Map< const Eigen::Matrix< typename T::Scalar, x, y > >( t.data() );
     }
 
+    /**
+     * Map a contiguous, column major Eigen::Matrix or Eigen::TensorFixedSize as Eigen::TensorFixedSize with
+     * dimensions \ref dims without copying, e.g., a Matrix9d as Tensor3333d */
+    template < Eigen::Index... dims,
+               typename T,
+               typename = std::enable_if_t< !std::is_const< std::remove_reference_t< T > >::value > >
+    auto asTensor( T& t )
+    {
+      checkReinterpretable< T, ( dims * ... ) >();
+      return Eigen::TensorMap< Eigen::TensorFixedSize< typename T::Scalar, Eigen::Sizes< dims... > > >(
+        t.data(),
+        Eigen::Sizes< dims... >() );
+    }
+
+    template < Eigen::Index... dims, typename T, typename = void >
+    auto asTensor( const T& t )
+    {
+      checkReinterpretable< T, ( dims * ... ) >();
+      return Eigen::TensorMap< const Eigen::TensorFixedSize< typename T::Scalar, Eigen::Sizes< dims... > > >(
+        t.data(),
+        Eigen::Sizes< dims... >() );
+    }
+
     template < typename Derived,
                typename = std::enable_if< !std::is_const< std::remove_reference< Derived > >::value > >
     auto flatten( Derived& t )
     {
-      return Eigen::Map<
-        Eigen::Matrix< typename Derived::Scalar, Derived::RowsAtCompileTime * Derived::ColsAtCompileTime, 1 > >(
-        t.data() );
+      using Plain = std::remove_reference_t< Derived >;
+      static_assert( IsContiguous< Plain >::value, "only contiguous storage can be flattened" );
+      return Eigen::Map< Eigen::Matrix< typename Derived::Scalar, CompileTimeSize< Plain >::value, 1 > >( t.data() );
     }
 
     template < typename Derived, typename = void >
     auto flatten( const Derived& t )
     {
-      return Eigen::Map<
-        const Eigen::Matrix< typename Derived::Scalar, Derived::RowsAtCompileTime * Derived::ColsAtCompileTime, 1 > >(
+      using Plain = std::remove_const_t< std::remove_reference_t< Derived > >;
+      static_assert( IsContiguous< Plain >::value, "only contiguous storage can be flattened" );
+      return Eigen::Map< const Eigen::Matrix< typename Derived::Scalar, CompileTimeSize< Plain >::value, 1 > >(
         t.data() );
     }
 
+    /**
+     * Map raw, column major (Fortran ordered) host code arrays, e.g., Abaqus' STATEV or DDSDDE, as Eigen::Matrix of
+     * size \ref x times \ref y without copying. A pointer to const yields a read-only map */
+    template < int x, int y, typename Scalar >
+    auto map( Scalar* data )
+    {
+      static_assert( x > 0 && y > 0, "mapped raw arrays require a fixed size" );
+      using Matrix = Eigen::Matrix< std::remove_const_t< Scalar >, x, y >;
+      return Eigen::Map< std::conditional_t< std::is_const< Scalar >::value, const Matrix, Matrix > >( data );
+    }
+
+    /**
+     * Map raw host code arrays with arbitrary strides as Eigen::Matrix of size \ref x times \ref y, e.g., the
+     * upper left 6x6 block of an Abaqus DDSDDE with leading dimension NTENS */
+    template < int x, int y, typename Scalar >
+    auto mapStrided( Scalar* data, Eigen::Index outerStride, Eigen::Index innerStride = 1 )
+    {
+      static_assert( x > 0 && y > 0, "mapped raw arrays require a fixed size" );
+      using Matrix = Eigen::Matrix< std::remove_const_t< Scalar >, x, y >;
+      using Stride = Eigen::Stride< Eigen::Dynamic, Eigen::Dynamic >;
+      return Eigen::Map< std::conditional_t< std::is_const< Scalar >::value, const Matrix, Matrix >,
+                         Eigen::Unaligned,
+                         Stride >( data, Stride( outerStride, innerStride ) );
+    }
+
+    /**
+     * Map raw host code arrays as Eigen::TensorFixedSize with dimensions \ref dims without copying */
+    template < Eigen::Index... dims, typename Scalar >
+    auto mapTensor( Scalar* data )
+    {
+      using Tensor = Eigen::TensorFixedSize< std::remove_const_t< Scalar >, Eigen::Sizes< dims... > >;
+      return Eigen::TensorMap< std::conditional_t< std::is_const< Scalar >::value, const Tensor, Tensor > >(
+        data,
+        Eigen::Sizes< dims... >() );
+    }
+
     Eigen::Matrix3d dyadicProduct( const Eigen::Vector3d& vector1, const Eigen::Vector3d& vector2 );
 
     namespace IndexNotation {
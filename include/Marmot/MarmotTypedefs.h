@@ -38,8 +38,10 @@ namespace Marmot {
   typedef Eigen::Matrix< double, 3, 4 > Matrix34d;
   typedef Eigen::Map< Matrix6d >        mMatrix6d;
   typedef Eigen::Matrix< double, 3, 3 > Matrix3d;
+  typedef Eigen::Matrix< double, 4, 4 > Matrix4d;
 
   typedef Eigen::Matrix< double, 3, 1 >        Vector3d;
+  typedef Eigen::Matrix< double, 4, 1 >        Vector4d;
   typedef Eigen::Matrix< double, 6, 1 >        Vector6d;
   typedef Eigen::Matrix< double, 7, 1 >        Vector7d;
   typedef Eigen::Matrix< double, 8, 1 >        Vector8d;
@@ -59,13 +61,54 @@ namespace Marmot {
   typedef std::complex< double >               complexDouble;
   typedef Eigen::Matrix< complexDouble, 6, 1 > Vector6cd;
 
-  // definitions for templated scalar type
+  // definitions for templated scalar type, e.g., float for explicit dynamics or long double for reference solutions
+  template < typename T >
+  using Vector3t = Eigen::Matrix< T, 3, 1 >;
+
+  template < typename T >
+  using Vector4t = Eigen::Matrix< T, 4, 1 >;
+
   template < typename T >
   using Vector6t = Eigen::Matrix< T, 6, 1 >;
 
+  template < typename T >
+  using Vector9t = Eigen::Matrix< T, 9, 1 >;
+
   template < typename T >
   using VectorXt = Eigen::Matrix< T, -1, 1 >;
 
+  template < typename T >
+  using RowVector6t = Eigen::Matrix< T, 1, 6 >;
+
+  template < typename T >
+  using Matrix3t = Eigen::Matrix< T, 3, 3 >;
+
+  template < typename T >
+  using Matrix4t = Eigen::Matrix< T, 4, 4 >;
+
+  template < typename T >
+  using Matrix6t = Eigen::Matrix< T, 6, 6 >;
+
+  template < typename T >
+  using Matrix36t = Eigen::Matrix< T, 3, 6 >;
+
+  template < typename T >
+  using Matrix63t = Eigen::Matrix< T, 6, 3 >;
+
+  template < typename T >
+  using Matrix69t = Eigen::Matrix< T, 6, 9 >;
+
+  template < typename T >
+  using Matrix9t = Eigen::Matrix< T, 9, 9 >;
+
+  template < typename T >
+  using MatrixXt = Eigen::Matrix< T, -1, -1 >;
+
+  typedef Vector6t< float >       Vector6f;
+  typedef Matrix6t< float >       Matrix6f;
+  typedef Vector6t< long double > Vector6ld;
+  typedef Matrix6t< long double > Matrix6ld;
+
   namespace EigenTensors {
 
     typedef Eigen::TensorFixedSize< double, Eigen::Sizes< 6, 3, 3 > >    Tensor633d;
@@ -78,6 +121,19 @@ namespace Marmot {
     typedef Eigen::TensorFixedSize< double, Eigen::Sizes< 2, 1, 2, 2 > > Tensor2122d;
     typedef Eigen::TensorFixedSize< double, Eigen::Sizes< 2, 1, 1, 2 > > Tensor2112d;
 
+    template < typename T >
+    using Tensor333t = Eigen::TensorFixedSize< T, Eigen::Sizes< 3, 3, 3 > >;
+
+    template < typename T >
+    using Tensor3333t = Eigen::TensorFixedSize< T, Eigen::Sizes< 3, 3, 3, 3 > >;
+
+    template < typename T >
+    using Tensor633t = Eigen::TensorFixedSize< T, Eigen::Sizes< 6, 3, 3 > >;
+
+    /// fourth order tensor of dimension \ref nDim, e.g., TensorNNNN< 2 > is Tensor2222d
+    template < int nDim, typename T = double >
+    using TensorNNNN = Eigen::TensorFixedSize< T, Eigen::Sizes< nDim, nDim, nDim, nDim > >;
+
   } // namespace EigenTensors
 
 } // namespace Marmot
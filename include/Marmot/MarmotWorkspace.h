@@ -0,0 +1,79 @@
+/* ---------------------------------------------------------------------
+ *                                       _
+ *  _ __ ___   __ _ _ __ _ __ ___   ___ | |_
+ * | '_ ` _ \ / _` | '__| '_ ` _ \ / _ \| __|
+ * | | | | | | (_| | |  | | | | | | (_) | |_
+ * |_| |_| |_|\__,_|_|  |_| |_| |_|\___/ \__|
+ *
+ * Unit of Strength of Materials and Structural Analysis
+ * University of Innsbruck,
+ * 2020 - today
+ *
+ * festigkeitslehre@uibk.ac.at
+ *
+ * Matthias Neuner matthias.neuner@uibk.ac.at
+ *
+ * This file is part of the MAteRialMOdellingToolbox (marmot).
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * The full text of the license can be found in the file LICENSE.md at
+ * the top level directory of marmot.
+ * ---------------------------------------------------------------------
+ */
+
+#pragma once
+#include "Marmot/MarmotTypedefs.h"
+#include "autodiff/forward/dual.hpp"
+#include "autodiff/forward/dual/eigen.hpp"
+#include <array>
+#include <complex>
+#include <tuple>
+
+namespace Marmot {
+
+  /**
+   * Scratch memory of the dynamic size kernels, e.g., the finite difference and automatic differentiation Jacobians.
+   *
+   * Thread safety: the library keeps no mutable global state, all functions are reentrant, and the global constants
+   * (e.g., ContinuumMechanics::CommonTensors) are immutable after static initialization. A Workspace, however, is not
+   * synchronized: keep one per thread (e.g., thread_local or one per task of the thread pool), and pass it to the
+   * overloads taking a Workspace&. After the first call with a given problem size, these overloads perform no heap
+   * allocations of their own; allocations of the user supplied functions are not affected.
+   */
+  class Workspace {
+
+  public:
+    /// number of scratch vectors per scalar type
+    static constexpr int nSlots = 8;
+
+    /**
+     * Scratch vector \ref slot of scalar type \ref Scalar, resized to \ref size entries. Its memory is reused as long
+     * as the size does not change, its contents are unspecified */
+    template < typename Scalar >
+    VectorXt< Scalar >& vector( int slot, Eigen::Index size )
+    {
+      VectorXt< Scalar >& buffer = std::get< Slots< Scalar > >( storage )[slot];
+      buffer.resize( size );
+      return buffer;
+    }
+
+  private:
+    template < typename Scalar >
+    using Slots = std::array< VectorXt< Scalar >, nSlots >;
+
+    std::tuple< Slots< float >,
+                Slots< double >,
+                Slots< long double >,
+                Slots< std::complex< float > >,
+                Slots< std::complex< double > >,
+                Slots< std::complex< long double > >,
+                Slots< autodiff::dual >,
+                Slots< autodiff::dual2nd > >
+      storage;
+  };
+
+} // namespace Marmot
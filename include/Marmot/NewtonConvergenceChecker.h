@@ -48,18 +48,18 @@ namespace Marmot::NumericalAlgorithms {
                               double                 newtonTolAlt,
                               double                 newtonRTolAlt );
 
-    double relativeNorm( const Eigen::VectorXd& increment, const Eigen::VectorXd& reference );
+    double relativeNorm( const Eigen::VectorXd& increment, const Eigen::VectorXd& reference ) const;
 
-    double residualNorm( const Eigen::VectorXd& Residual );
+    double residualNorm( const Eigen::VectorXd& Residual ) const;
 
     bool iterationFinished( const Eigen::VectorXd& residual,
                             const Eigen::VectorXd& X,
                             const Eigen::VectorXd& dX,
-                            int                    numberOfIterations );
+                            int                    numberOfIterations ) const;
 
     bool isConverged( const Eigen::VectorXd& residual,
                       const Eigen::VectorXd& X,
                       const Eigen::VectorXd& dX,
-                      int                    numberOfIterations );
+                      int                    numberOfIterations ) const;
   };
 } // namespace Marmot::NumericalAlgorithms
@@ -7,4 +7,44 @@ list(APPEND publicheaders
     "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotConstants.h" 
     "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotTensor.h" 
     "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotTypedefs.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotBatch.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotOrientationTable.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotProfiling.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotAllocationTracking.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotWorkspace.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotArena.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotImplicitIntegration.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotDenseSolvers.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotStressInvariants.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotImplicitFunctionTangent.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotMemoization.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotTabulatedFunction.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotEinsum.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotReducedVoigt.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotTangentVerification.h" 
+    "${CMAKE_CURRENT_LIST_DIR}/include/Marmot/MarmotNewtonKrylov.h" 
     )
+
+option( MARMOT_MATHCORE_PROFILING "Enable the profiling scopes and counters of MarmotMathCore" OFF )
+if( MARMOT_MATHCORE_PROFILING )
+  add_compile_definitions( MARMOT_ENABLE_PROFILING )
+endif()
+
+# replaces the global allocation functions to count heap allocations; for tests and benchmarks only
+option( MARMOT_MATHCORE_ALLOCATION_TRACKING "Track heap allocations in MarmotMathCore tests and benchmarks" OFF )
+if( MARMOT_MATHCORE_ALLOCATION_TRACKING )
+  add_compile_definitions( MARMOT_ENABLE_ALLOCATION_TRACKING )
+  # not part of libMarmot, so that programs linking Marmot keep the global allocation functions
+  add_library( MarmotAllocationTracking OBJECT "${CMAKE_CURRENT_LIST_DIR}/test/MarmotAllocationTracking.cpp" )
+endif()
+
+option( MARMOT_MATHCORE_BENCHMARKS "Build the MarmotMathCore benchmark executable" OFF )
+if( MARMOT_MATHCORE_BENCHMARKS )
+  # run with --json=<file> to write the results in the Google Benchmark JSON format
+  file( GLOB sources_benchmark "${CMAKE_CURRENT_LIST_DIR}/benchmark/*.cpp" )
+  add_executable( MarmotMathCoreBenchmarks ${sources_benchmark} )
+  target_link_libraries( MarmotMathCoreBenchmarks Marmot )
+  if( MARMOT_MATHCORE_ALLOCATION_TRACKING )
+    target_link_libraries( MarmotMathCoreBenchmarks MarmotAllocationTracking )
+  endif()
+endif()
@@ -0,0 +1,53 @@
+#include "Marmot/MarmotArena.h"
+#include <algorithm>
+
+namespace Marmot {
+
+  Arena::Arena( std::size_t blockSize ) : blockSize( blockSize ), current( 0 ), offset( 0 ) {}
+
+  Arena& Arena::threadLocal()
+  {
+    thread_local Arena arena;
+    return arena;
+  }
+
+  void* Arena::allocate( std::size_t bytes )
+  {
+    // keep subsequent allocations aligned
+    bytes = ( bytes + alignment - 1 ) / alignment * alignment;
+
+    while ( current < blocks.size() ) {
+      if ( offset + bytes <= blocks[current].size ) {
+        void* memory = blocks[current].memory.get() + offset;
+        offset += bytes;
+        return memory;
+      }
+      current++;
+      offset = 0;
+    }
+
+    // no block left with sufficient space
+    const std::size_t size = std::max( blockSize, bytes );
+    blocks.push_back( { std::unique_ptr< std::byte[], BlockDeleter >(
+                          new ( std::align_val_t( alignment ) ) std::byte[size] ),
+                        size } );
+    current = blocks.size() - 1;
+    offset  = bytes;
+    return blocks[current].memory.get();
+  }
+
+  void Arena::rewind( const Marker& marker )
+  {
+    current = marker.block;
+    offset  = marker.offset;
+  }
+
+  std::size_t Arena::capacity() const
+  {
+    std::size_t size = 0;
+    for ( const auto& block : blocks )
+      size += block.size;
+    return size;
+  }
+
+} // namespace Marmot
@@ -1,7 +1,9 @@
 #include "Marmot/MarmotAutomaticDifferentiation.h"
+#include "Marmot/MarmotProfiling.h"
 #include <autodiff/forward/dual/eigen.hpp>
 #include <autodiff/forward/utils/derivative.hpp>
 #include <iostream>
+#include <stdexcept>
 
 using namespace autodiff;
 using namespace Eigen;
@@ -10,6 +12,15 @@ namespace Marmot {
 
   namespace AutomaticDifferentiation {
 
+    namespace {
+      template < typename VectorType, typename MatrixType >
+      void checkOutputSizes( const VectorType& F_, const MatrixType& J, Eigen::Index sizeX )
+      {
+        if ( F_.size() != sizeX || J.rows() != sizeX || J.cols() != sizeX )
+          throw std::invalid_argument( "jacobian: outputs must be sized according to X" );
+      }
+    } // namespace
+
     dual2nd shiftTo2ndOrderDual( const dual& x )
     {
       dual2nd x2nd( 0.0 );
@@ -32,6 +43,9 @@ namespace Marmot {
 
     double df_dx( const scalar_to_scalar_function_type& f, const double& x )
     {
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::df_dx" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
       dual x_right;
       x_right.val = x;
       seed< 1 >( x_right, 1.0 );
@@ -43,6 +57,8 @@ namespace Marmot {
 
     dual df_dx( const scalar_to_scalar_function_type_2nd& f, const dual& x )
     {
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::df_dx" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
 
       dual2nd x_right = shiftTo2ndOrderDual( x );
       seed< 1 >( x_right, 1.0 );
@@ -56,26 +72,35 @@ namespace Marmot {
     }
     MatrixXd forwardMode( const vector_to_vector_function_type& F, const VectorXd& X )
     {
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::forwardMode" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( X.size() );
+
       VectorXdual X_( X );
       const auto  J = jacobian( F, wrt( X_ ), at( X_ ) );
 
       return J;
     }
 
-    std::pair< VectorXd, MatrixXd > jacobian( const vector_to_vector_function_type_dual& F, const VectorXd& X )
+    void jacobian( const vector_to_vector_function_type_dual& F,
+                   const VectorXd&                            X,
+                   Eigen::Ref< VectorXd >                     F_,
+                   Eigen::Ref< MatrixXd >                     J,
+                   Workspace&                                 workspace )
     {
-      VectorXdual  X_( X );
-      VectorXdual  F_right;
-      const size_t sizeX = X_.rows();
-      MatrixXd     J( sizeX, sizeX );
-      VectorXd     F_( sizeX );
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::jacobian" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( X.size() );
+
+      const size_t sizeX = X.rows();
+      VectorXdual& X_    = workspace.vector< dual >( 0, sizeX );
+      X_                 = X.cast< dual >();
+      checkOutputSizes( F_, J, sizeX );
 
       // J_ij = d F_i / d x_j
 
       for ( size_t j = 0; j < sizeX; j++ ) {
 
         seed< 1 >( X_( j ), 1.0 );
-        F_right = F( X_ );
+        const VectorXdual F_right = F( X_ );
 
         for ( size_t i = 0; i < sizeX; i++ ) {
           J( i, j ) = derivative< 1 >( F_right( i ) );
@@ -83,17 +108,56 @@ namespace Marmot {
         seed< 1 >( X_( j ), 0.0 );
         F_( j ) = F_right( j ).val;
       }
+    }
 
+    std::pair< VectorXd, MatrixXd > jacobian( const vector_to_vector_function_type_dual& F, const VectorXd& X )
+    {
+      Workspace workspace;
+      VectorXd  F_( X.size() );
+      MatrixXd  J( X.size(), X.size() );
+      jacobian( F, X, F_, J, workspace );
       return { F_, J };
     }
-    std::pair< VectorXdual, MatrixXdual > jacobian2nd( const vector_to_vector_function_type_dual2nd& F,
-                                                       const VectorXdual&                            X )
+
+    std::pair< VectorXd, VectorXd > jvp( const vector_to_vector_function_type_dual& F,
+                                         const VectorXd&                            X,
+                                         const VectorXd&                            v )
+    {
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::jvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+      if ( v.size() != X.size() )
+        throw std::invalid_argument( "jvp: direction v must be of the size of X" );
+
+      VectorXdual X_ = X.cast< dual >();
+      for ( Eigen::Index j = 0; j < X.size(); j++ )
+        seed< 1 >( X_( j ), v( j ) );
+
+      const VectorXdual F_ = F( X_ );
+      VectorXd          FX( F_.size() );
+      VectorXd          Jv( F_.size() );
+      for ( Eigen::Index i = 0; i < F_.size(); i++ ) {
+        FX( i ) = F_( i ).val;
+        Jv( i ) = derivative< 1 >( F_( i ) );
+      }
+
+      return { FX, Jv };
+    }
+
+    void jacobian2nd( const vector_to_vector_function_type_dual2nd& F,
+                      const VectorXdual&                            X,
+                      Eigen::Ref< VectorXdual >                     F_,
+                      Eigen::Ref< MatrixXdual >                     J,
+                      Workspace&                                    workspace )
     {
-      VectorXdual2nd X_ = increaseDualOrderWithShift< 1 >( X );
-      VectorXdual2nd F_right;
-      const size_t   sizeX = X_.rows();
-      MatrixXdual    J( sizeX, sizeX );
-      VectorXdual    F_( sizeX );
+      MARMOT_PROFILE_SCOPE( "AutomaticDifferentiation::jacobian2nd" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( X.size() );
+
+      const size_t    sizeX = X.rows();
+      VectorXdual2nd& X_    = workspace.vector< dual2nd >( 0, sizeX );
+      for ( size_t j = 0; j < sizeX; j++ )
+        X_( j ) = increaseDualOrderWithShift< 1 >( X( j ) );
+      checkOutputSizes( F_, J, sizeX );
 
       /* std::cout << " X ="<< X << std::endl; */
       // J_ij = d F_i / d x_j
@@ -101,7 +165,7 @@ namespace Marmot {
       for ( size_t j = 0; j < sizeX; j++ ) {
 
         seed< 1 >( X_( j ), 1.0 );
-        F_right = F( X_ );
+        const VectorXdual2nd F_right = F( X_ );
 
         /* std::cout << " F ="<< F_right << std::endl; */
 
@@ -114,7 +178,15 @@ namespace Marmot {
         F_( j ).val  = F_right( j ).val.val;
         F_( j ).grad = derivative< 1 >( F_right( j ) );
       }
+    }
 
+    std::pair< VectorXdual, MatrixXdual > jacobian2nd( const vector_to_vector_function_type_dual2nd& F,
+                                                       const VectorXdual&                            X )
+    {
+      Workspace   workspace;
+      VectorXdual F_( X.size() );
+      MatrixXdual J( X.size(), X.size() );
+      jacobian2nd( F, X, F_, J, workspace );
       return { F_, J };
     }
   } // namespace AutomaticDifferentiation
@@ -9,17 +9,6 @@ namespace Marmot {
       return y0 + ( x - x0 ) * ( y1 - y0 ) / ( x1 - x0 );
     }
 
-    // bounded version of std::exp
-    double exp( double x )
-    {
-      if ( x <= -64 ) // underflow if arg < -708.4 (type double)
-        return 0.0;
-      if ( x >= 64 ) // overflow if arg > 709.8 (type double), leave ample margin (e.g. for
-                     // squaring)
-        return std::exp( 64 );
-      return std::exp( x );
-    }
-
     double makeReal( const complexDouble& value )
     {
       return value.real();
@@ -53,7 +42,7 @@ namespace Marmot {
     Matrix3d orthonormalCoordinateSystem( Vector3d& normalVector )
     {
       normalVector.normalize();
-      Matrix3d coordinateSystem = Eigen::MatrixXd::Zero( 3, 3 );
+      Matrix3d coordinateSystem = Matrix3d::Zero();
       coordinateSystem.col( 0 ) = normalVector;
 
       if ( coordinateSystem( 0, 0 ) == 0 && coordinateSystem( 1, 0 ) == 0 ) {
@@ -79,7 +68,7 @@ namespace Marmot {
       if ( std::abs( n1.dot( n2 ) ) > 1e-15 )
         throw std::invalid_argument( "n1 and n2 not orthogonal" );
 
-      Matrix3d coordinateSystem = Eigen::MatrixXd::Zero( 3, 3 );
+      Matrix3d coordinateSystem = Matrix3d::Zero();
       coordinateSystem.col( 0 ) = n1;
       coordinateSystem.col( 1 ) = n2;
 
@@ -95,17 +84,194 @@ namespace Marmot {
 
     Matrix3d directionCosines( const Matrix3d& transformedCoordinateSystem )
     {
-      Vector3d unitVectorX1;
-      unitVectorX1 << 1, 0, 0;
+      // the global coordinate system is the identity, hence directionCos( i, j ) = transformed.col( i ).dot( e_j )
+      return transformedCoordinateSystem.transpose();
+    }
+
+    Vector3d eigenValuesSymmetric3x3( const Matrix3d& A )
+    {
+      // scale to avoid over- and underflow in the characteristic polynomial
+      const double scale = A.cwiseAbs().maxCoeff();
+      if ( scale == 0 )
+        return Vector3d::Zero();
 
-      Matrix3d globalCoordinateSystem = orthonormalCoordinateSystem( unitVectorX1 );
-      Matrix3d directionCos;
+      const Matrix3d As = A / scale;
+      const double   q  = As.trace() / 3.;
+      const Matrix3d B  = As - q * Matrix3d::Identity();
+      const double   p  = std::sqrt( B.squaredNorm() / 6. );
+
+      if ( p == 0 )
+        return Vector3d::Constant( q * scale );
+
+      // acos( halfDet ) / 3 expressed by atan2, so that all roots follow from a single sine and cosine
+      const double halfDet = std::clamp( ( B / p ).determinant() / 2., -1., 1. );
+      const double angle   = std::atan2( std::sqrt( 1. - halfDet * halfDet ), halfDet ) / 3.;
+      const double cosA    = std::cos( angle );
+      const double sinA    = std::sin( angle );
+
+      Vector3d eigenValues;
+      eigenValues( 2 ) = q + 2. * p * cosA;
+      eigenValues( 0 ) = q - p * ( cosA + Constants::sqrt3 * sinA );
+      eigenValues( 1 ) = q - p * ( cosA - Constants::sqrt3 * sinA );
+
+      return eigenValues * scale;
+    }
 
-      for ( int i = 0; i <= 2; i++ )
-        for ( int j = 0; j <= 2; j++ )
-          directionCos( i, j ) = transformedCoordinateSystem.col( i ).dot( globalCoordinateSystem.col( j ) );
+    namespace {
 
-      return directionCos;
+      // unit eigenvector of the simple eigenvalue lambda as the largest cross product of two rows of A - lambda I
+      Vector3d eigenVectorOfSimpleEigenValue( const Matrix3d& A, double lambda )
+      {
+        const Matrix3d M = A - lambda * Matrix3d::Identity();
+
+        const Vector3d r0xr1 = M.row( 0 ).transpose().cross( M.row( 1 ).transpose() );
+        const Vector3d r0xr2 = M.row( 0 ).transpose().cross( M.row( 2 ).transpose() );
+        const Vector3d r1xr2 = M.row( 1 ).transpose().cross( M.row( 2 ).transpose() );
+
+        const double d0 = r0xr1.squaredNorm();
+        const double d1 = r0xr2.squaredNorm();
+        const double d2 = r1xr2.squaredNorm();
+
+        if ( d0 >= d1 && d0 >= d2 )
+          return r0xr1 / std::sqrt( d0 );
+        if ( d1 >= d2 )
+          return r0xr2 / std::sqrt( d1 );
+        return r1xr2 / std::sqrt( d2 );
+      }
+
+      // unit eigenvector of lambda orthogonal to the already known unit eigenvector n, computed from the 2x2 problem in
+      // the orthogonal complement of n; robust also for repeated eigenvalues
+      Vector3d eigenVectorInOrthogonalComplement( const Matrix3d& A, const Vector3d& n, double lambda )
+      {
+        Vector3d U;
+        if ( std::abs( n( 0 ) ) > std::abs( n( 1 ) ) )
+          U << -n( 2 ), 0, n( 0 );
+        else
+          U << 0, n( 2 ), -n( 1 );
+        U.normalize();
+        const Vector3d V = n.cross( U );
+
+        double m00 = U.dot( A * U ) - lambda;
+        double m01 = U.dot( A * V );
+        double m11 = V.dot( A * V ) - lambda;
+
+        const double absM00 = std::abs( m00 );
+        const double absM01 = std::abs( m01 );
+        const double absM11 = std::abs( m11 );
+
+        if ( absM00 >= absM11 ) {
+          if ( std::max( absM00, absM01 ) == 0 )
+            return U;
+          if ( absM00 >= absM01 ) {
+            m01 /= m00;
+            m00 = 1. / std::sqrt( 1. + m01 * m01 );
+            m01 *= m00;
+          }
+          else {
+            m00 /= m01;
+            m01 = 1. / std::sqrt( 1. + m00 * m00 );
+            m00 *= m01;
+          }
+          return m01 * U - m00 * V;
+        }
+
+        if ( std::max( absM11, absM01 ) == 0 )
+          return U;
+        if ( absM11 >= absM01 ) {
+          m01 /= m11;
+          m11 = 1. / std::sqrt( 1. + m01 * m01 );
+          m01 *= m11;
+        }
+        else {
+          m11 /= m01;
+          m01 = 1. / std::sqrt( 1. + m11 * m11 );
+          m11 *= m01;
+        }
+        return m11 * U - m01 * V;
+      }
+
+    } // namespace
+
+    std::pair< Vector3d, Matrix3d > eigenDecompositionSymmetric3x3( const Matrix3d& A )
+    {
+      if ( A( 0, 1 ) == 0 && A( 0, 2 ) == 0 && A( 1, 2 ) == 0 ) {
+        // already diagonal, sort the eigenvalues in ascending order
+        Eigen::Vector3i order( 0, 1, 2 );
+        std::sort( order.data(), order.data() + 3, [&]( int a, int b ) { return A( a, a ) < A( b, b ); } );
+
+        Vector3d eigenValues;
+        Matrix3d eigenVectors = Matrix3d::Zero();
+        for ( int i = 0; i < 3; i++ ) {
+          eigenValues( i )                = A( order( i ), order( i ) );
+          eigenVectors( order( i ), i ) = 1.0;
+        }
+        return { eigenValues, eigenVectors };
+      }
+
+      const double   scale       = A.cwiseAbs().maxCoeff();
+      const Matrix3d As          = A / scale;
+      const Vector3d eigenValues = eigenValuesSymmetric3x3( As );
+
+      // start with the eigenvalue which is well separated from the others
+      Matrix3d eigenVectors;
+      if ( eigenValues( 2 ) - eigenValues( 1 ) >= eigenValues( 1 ) - eigenValues( 0 ) ) {
+        eigenVectors.col( 2 ) = eigenVectorOfSimpleEigenValue( As, eigenValues( 2 ) );
+        eigenVectors.col( 1 ) = eigenVectorInOrthogonalComplement( As, eigenVectors.col( 2 ), eigenValues( 1 ) );
+        eigenVectors.col( 0 ) = eigenVectors.col( 1 ).cross( eigenVectors.col( 2 ) );
+      }
+      else {
+        eigenVectors.col( 0 ) = eigenVectorOfSimpleEigenValue( As, eigenValues( 0 ) );
+        eigenVectors.col( 1 ) = eigenVectorInOrthogonalComplement( As, eigenVectors.col( 0 ), eigenValues( 1 ) );
+        eigenVectors.col( 2 ) = eigenVectors.col( 0 ).cross( eigenVectors.col( 1 ) );
+      }
+
+      // the trigonometric eigenvalues lose accuracy for nearly repeated eigenvalues; a single cyclic Jacobi sweep on
+      // the almost diagonal matrix N^T A N restores full precision
+      Matrix3d D = eigenVectors.transpose() * As * eigenVectors;
+      for ( int p = 0; p < 2; p++ )
+        for ( int q = p + 1; q < 3; q++ ) {
+          const double Dpq = D( p, q );
+          if ( std::abs( Dpq ) <= std::numeric_limits< double >::epsilon() * std::abs( D( q, q ) - D( p, p ) ) )
+            continue;
+
+          const double theta = ( D( q, q ) - D( p, p ) ) / ( 2. * Dpq );
+          const double t     = std::copysign( 1., theta ) / ( std::abs( theta ) + std::sqrt( theta * theta + 1. ) );
+          const double c     = 1. / std::sqrt( t * t + 1. );
+          const double s     = t * c;
+
+          Eigen::Matrix< double, 3, 2 > Dcols;
+          Dcols << D.col( p ), D.col( q );
+          D.col( p ) = c * Dcols.col( 0 ) - s * Dcols.col( 1 );
+          D.col( q ) = s * Dcols.col( 0 ) + c * Dcols.col( 1 );
+          Eigen::Matrix< double, 2, 3 > Drows;
+          Drows << D.row( p ), D.row( q );
+          D.row( p ) = c * Drows.row( 0 ) - s * Drows.row( 1 );
+          D.row( q ) = s * Drows.row( 0 ) + c * Drows.row( 1 );
+
+          const Vector3d np     = eigenVectors.col( p );
+          eigenVectors.col( p ) = c * np - s * eigenVectors.col( q );
+          eigenVectors.col( q ) = s * np + c * eigenVectors.col( q );
+        }
+
+      // restore the ascending order, which the polish may have swapped for (nearly) repeated eigenvalues
+      Vector3d polishedEigenValues = D.diagonal();
+      for ( int i : { 0, 1, 0 } )
+        if ( polishedEigenValues( i ) > polishedEigenValues( i + 1 ) ) {
+          std::swap( polishedEigenValues( i ), polishedEigenValues( i + 1 ) );
+          eigenVectors.col( i ).swap( eigenVectors.col( i + 1 ) );
+        }
+
+      return { polishedEigenValues * scale, eigenVectors };
+    }
+
+    Eigen::Matrix< double, 3, 9 > dEigenValues_dTensor( const Matrix3d& eigenVectors )
+    {
+      Eigen::Matrix< double, 3, 9 > dLambda_dA;
+      for ( int i = 0; i < 3; i++ ) {
+        const Matrix3d nxn = eigenVectors.col( i ) * eigenVectors.col( i ).transpose();
+        dLambda_dA.row( i ) = Eigen::Map< const Eigen::Matrix< double, 1, 9 > >( nxn.data() );
+      }
+      return dLambda_dA;
     }
   } // namespace Math
 } // namespace Marmot
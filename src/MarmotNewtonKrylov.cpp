@@ -0,0 +1,192 @@
+#include "Marmot/MarmotNewtonKrylov.h"
+#include "Marmot/MarmotArena.h"
+#include "Marmot/MarmotProfiling.h"
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+
+using namespace Eigen;
+
+namespace Marmot::NumericalAlgorithms::NewtonKrylov {
+
+  GMRESResult gmres( const linear_operator_type& A,
+                     const VectorXd&             b,
+                     Ref< VectorXd >             x,
+                     const GMRESOptions&         options,
+                     const preconditioner_type&  preconditioner )
+  {
+    MARMOT_PROFILE_SCOPE( "NewtonKrylov::gmres" );
+
+    const Index n = b.size();
+    if ( x.size() != n )
+      throw std::invalid_argument( "gmres: x must be of the size of b" );
+    if ( options.restart < 1 )
+      throw std::invalid_argument( "gmres: the restart length must be positive" );
+
+    const double bNorm = b.norm();
+    if ( bNorm == 0 ) {
+      x.setZero();
+      return { true, 0., 0 };
+    }
+
+    const double tolerance = options.relativeTolerance * bNorm;
+    const int    m         = static_cast< int >( std::min< Index >( options.restart, n ) );
+
+    Arena::Scope scope;
+    Arena&       arena = Arena::threadLocal();
+    auto         V     = arena.matrix< double >( n, m + 1 ); // orthonormal basis of the Krylov subspace
+    auto         H     = arena.matrix< double >( m + 1, m ); // Hessenberg matrix, reduced to upper triangular form
+    auto         c     = arena.vector< double >( m );        // Givens rotations
+    auto         s     = arena.vector< double >( m );
+    auto         g     = arena.vector< double >( m + 1 );    // rotated right hand side | r0 | e_1
+    auto         y     = arena.vector< double >( m );
+    auto         w     = arena.vector< double >( n );
+
+    // the operators take a VectorXd, hence their arguments are passed through this single heap allocated vector
+    VectorXd z( n );
+
+    double residual   = 0;
+    int    iterations = 0;
+
+    while ( true ) {
+      // r0 = b - A x, stored in the first basis vector
+      if ( x.isZero( 0 ) )
+        V.col( 0 ) = b;
+      else {
+        z          = x;
+        V.col( 0 ) = b - A( z );
+      }
+      residual = V.col( 0 ).norm();
+      if ( residual <= tolerance || iterations >= options.maxIterations )
+        break;
+
+      V.col( 0 ) /= residual;
+      g.setZero();
+      g( 0 ) = residual;
+
+      int k = 0;
+      while ( k < m && iterations < options.maxIterations ) {
+        z = V.col( k );
+        if ( preconditioner )
+          z = preconditioner( z );
+        w = A( z );
+
+        // modified Gram-Schmidt orthogonalization
+        for ( int i = 0; i <= k; i++ ) {
+          H( i, k ) = V.col( i ).dot( w );
+          w -= H( i, k ) * V.col( i );
+        }
+        H( k + 1, k ) = w.norm();
+        if ( H( k + 1, k ) > 0 )
+          V.col( k + 1 ) = w / H( k + 1, k );
+
+        for ( int i = 0; i < k; i++ ) {
+          const double h0 = H( i, k );
+          H( i, k )       = c( i ) * h0 + s( i ) * H( i + 1, k );
+          H( i + 1, k )   = -s( i ) * h0 + c( i ) * H( i + 1, k );
+        }
+        const double rho = std::hypot( H( k, k ), H( k + 1, k ) );
+        if ( rho == 0 )
+          // A is singular on the Krylov subspace
+          break;
+
+        c( k )        = H( k, k ) / rho;
+        s( k )        = H( k + 1, k ) / rho;
+        H( k, k )     = rho;
+        H( k + 1, k ) = 0;
+        g( k + 1 )    = -s( k ) * g( k );
+        g( k )        = c( k ) * g( k );
+
+        k++;
+        iterations++;
+        residual = std::abs( g( k ) );
+        if ( residual <= tolerance )
+          break;
+      }
+
+      if ( k == 0 )
+        break;
+
+      // x += M^-1 V y with H y = g
+      y.head( k ) = g.head( k );
+      H.topLeftCorner( k, k ).triangularView< Upper >().solveInPlace( y.head( k ) );
+      if ( preconditioner ) {
+        z.noalias() = V.leftCols( k ) * y.head( k );
+        x += preconditioner( z );
+      }
+      else
+        x.noalias() += V.leftCols( k ) * y.head( k );
+
+      if ( residual <= tolerance || iterations >= options.maxIterations )
+        break;
+    }
+
+    return { residual <= tolerance, residual / bNorm, iterations };
+  }
+
+  namespace {
+
+    /**
+     * Inexact Newton iteration; \ref jvp( X, v ) returns F( X ) and J( X ) v at the cost of one evaluation of F */
+    template < typename jvpType >
+    NewtonKrylovResult newtonKrylov( const jvpType&                  jvp,
+                                     const VectorXd&                 X0,
+                                     const NewtonConvergenceChecker& checker,
+                                     const GMRESOptions&             options,
+                                     const preconditioner_type&      preconditioner )
+    {
+      const VectorXd     zero = VectorXd::Zero( X0.size() );
+      NewtonKrylovResult result{ X0, false, 0, 0, 1 };
+
+      VectorXd R  = std::get< 0 >( jvp( result.X, zero ) );
+      VectorXd dX = zero;
+
+      while ( !checker.iterationFinished( R, result.X, dX, result.newtonIterations ) ) {
+        const VectorXd& X = result.X;
+        const auto      J = [&]( const VectorXd& v ) -> VectorXd {
+          result.residualEvaluations++;
+          return std::get< 1 >( jvp( X, v ) );
+        };
+
+        dX.setZero();
+        result.krylovIterations += gmres( J, -R, dX, options, preconditioner ).iterations;
+
+        result.X += dX;
+        R = std::get< 0 >( jvp( result.X, zero ) );
+        result.residualEvaluations++;
+        result.newtonIterations++;
+      }
+
+      result.converged = checker.isConverged( R, result.X, dX, result.newtonIterations );
+      return result;
+    }
+
+  } // namespace
+
+  NewtonKrylovResult solve( const AutomaticDifferentiation::vector_to_vector_function_type_dual& F,
+                            const VectorXd&                                                     X0,
+                            const NewtonConvergenceChecker&                                     checker,
+                            const GMRESOptions&                                                 options,
+                            const preconditioner_type&                                          preconditioner )
+  {
+    MARMOT_PROFILE_SCOPE( "NewtonKrylov::solve" );
+
+    const auto jvp = [&]( const VectorXd& X, const VectorXd& v ) { return AutomaticDifferentiation::jvp( F, X, v ); };
+    return newtonKrylov( jvp, X0, checker, options, preconditioner );
+  }
+
+  NewtonKrylovResult solveComplexStep( const Differentiation::Complex::vector_to_vector_function_type& F,
+                                       const VectorXd&                                                 X0,
+                                       const NewtonConvergenceChecker&                                 checker,
+                                       const GMRESOptions&                                             options,
+                                       const preconditioner_type&                                      preconditioner )
+  {
+    MARMOT_PROFILE_SCOPE( "NewtonKrylov::solveComplexStep" );
+
+    const auto jvp = [&]( const VectorXd& X, const VectorXd& v ) {
+      return Differentiation::Complex::forwardDifferenceJvp( F, X, v );
+    };
+    return newtonKrylov( jvp, X0, checker, options, preconditioner );
+  }
+
+} // namespace Marmot::NumericalAlgorithms::NewtonKrylov
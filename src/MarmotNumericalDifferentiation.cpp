@@ -1,60 +1,98 @@
 #include "Marmot/MarmotNumericalDifferentiation.h"
 #include "Marmot/MarmotConstants.h"
+#include "Marmot/MarmotProfiling.h"
 #include <complex>
+#include <stdexcept>
 
 using namespace Eigen;
 
 namespace Marmot {
   namespace NumericalAlgorithms::Differentiation {
 
-    double forwardDifference( const scalar_to_scalar_function_type& f, const double x )
+    namespace {
+      template < typename Derived >
+      void checkJacobianSize( const Eigen::MatrixBase< Derived >& J, Eigen::Index xSize )
+      {
+        if ( J.rows() != xSize || J.cols() != xSize )
+          throw std::invalid_argument( "Jacobian output must be a square matrix of the size of X" );
+      }
+
+      template < typename T >
+      void checkDirectionSize( const VectorXt< T >& v, Eigen::Index xSize )
+      {
+        if ( v.size() != xSize )
+          throw std::invalid_argument( "Direction v must be of the size of X" );
+      }
+    } // namespace
+
+    template < typename T >
+    T forwardDifference( const scalar_to_scalar_function_type_t< T >& f, const T x )
     {
-      double volatile h = std::max( 1.0, std::abs( x ) ) * Marmot::Constants::SquareRootEps;
-      const double out  = ( f( x + h ) - f( x ) ) / h;
+      MARMOT_PROFILE_SCOPE( "Differentiation::forwardDifference" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 );
+
+      T volatile h = std::max( T( 1 ), std::abs( x ) ) * Marmot::Constants::sqrtEps< T >;
+      const T out  = ( f( x + h ) - f( x ) ) / h;
       return out;
     }
 
-    double centralDifference( const scalar_to_scalar_function_type& f, const double x )
+    template < typename T >
+    T centralDifference( const scalar_to_scalar_function_type_t< T >& f, const T x )
     {
-      double volatile h = std::max( 1.0, std::abs( x ) ) * Marmot::Constants::CubicRootEps;
-      const double out  = ( f( x + h ) - f( x - h ) ) / ( 2. * h );
+      MARMOT_PROFILE_SCOPE( "Differentiation::centralDifference" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 );
+
+      T volatile h = std::max( T( 1 ), std::abs( x ) ) * Marmot::Constants::cbrtEps< T >;
+      const T out  = ( f( x + h ) - f( x - h ) ) / ( 2 * h );
       return out;
     }
 
-    MatrixXd forwardDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+    template < typename T >
+    void forwardDifference( const vector_to_vector_function_type_t< T >& F,
+                            const VectorXt< T >&                         X,
+                            Eigen::Ref< MatrixXt< T > >                  J,
+                            Workspace&                                   workspace )
     {
+      MARMOT_PROFILE_SCOPE( "Differentiation::forwardDifference" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( X.size() + 1 );
 
       const auto xSize = X.rows();
-      MatrixXd   J( xSize, xSize );
+      checkJacobianSize( J, xSize );
 
-      VectorXd rightX( xSize );
+      VectorXt< T >& rightX = workspace.vector< T >( 0, xSize );
+      VectorXt< T >& FX     = workspace.vector< T >( 1, xSize );
+      FX                    = F( X );
 
       for ( auto i = 0; i < xSize; i++ ) {
-        double volatile h = std::max( 1.0, std::abs( X( i ) ) ) * Marmot::Constants::SquareRootEps;
+        T volatile h = std::max( T( 1 ), std::abs( X( i ) ) ) * Marmot::Constants::sqrtEps< T >;
         // clang-format off
         rightX = X;
         rightX( i ) += h;
 
-        J.col( i ) = (  F( rightX )  - F( X  ) )
+        J.col( i ) = (  F( rightX )  - FX )
             / //------------------------------------
-                            ( 1. * h );
+                            ( T( 1 ) * h );
         // clang-format on
       }
-
-      return J;
     }
 
-    MatrixXd centralDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+    template < typename T >
+    void centralDifference( const vector_to_vector_function_type_t< T >& F,
+                            const VectorXt< T >&                         X,
+                            Eigen::Ref< MatrixXt< T > >                  J,
+                            Workspace&                                   workspace )
     {
+      MARMOT_PROFILE_SCOPE( "Differentiation::centralDifference" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 * X.size() );
 
       const auto xSize = X.rows();
-      MatrixXd   J( xSize, xSize );
+      checkJacobianSize( J, xSize );
 
-      VectorXd leftX( xSize );
-      VectorXd rightX( xSize );
+      VectorXt< T >& leftX  = workspace.vector< T >( 0, xSize );
+      VectorXt< T >& rightX = workspace.vector< T >( 1, xSize );
 
       for ( auto i = 0; i < xSize; i++ ) {
-        double volatile h = std::max( 1.0, std::abs( X( i ) ) ) * Marmot::Constants::CubicRootEps;
+        T volatile h = std::max( T( 1 ), std::abs( X( i ) ) ) * Marmot::Constants::cbrtEps< T >;
         // clang-format off
         leftX  = X;
         rightX = X;
@@ -63,13 +101,102 @@ namespace Marmot {
 
         J.col( i ) = (  F( rightX )  - F( leftX ) )
             / //------------------------------------
-                             ( 2. * h );
+                             ( T( 2 ) * h );
         // clang-format on
       }
+    }
+
+    template < typename T >
+    VectorXt< T > forwardDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                        const VectorXt< T >&                         X,
+                                        const VectorXt< T >&                         FX,
+                                        const VectorXt< T >&                         v )
+    {
+      MARMOT_PROFILE_SCOPE( "Differentiation::forwardDifferenceJvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+      checkDirectionSize( v, X.size() );
+      const T h = directionalStepSize( X, v, Marmot::Constants::sqrtEps< T > );
+      return ( F( X + h * v ) - FX ) / h;
+    }
+
+    template < typename T >
+    VectorXt< T > forwardDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                        const VectorXt< T >&                         X,
+                                        const VectorXt< T >&                         v )
+    {
+      return forwardDifferenceJvp< T >( F, X, F( X ), v );
+    }
+
+    template < typename T >
+    VectorXt< T > centralDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                        const VectorXt< T >&                         X,
+                                        const VectorXt< T >&                         v )
+    {
+      MARMOT_PROFILE_SCOPE( "Differentiation::centralDifferenceJvp" );
+      MARMOT_PROFILE_COUNT_EVALUATIONS( 2 );
+
+      checkDirectionSize( v, X.size() );
+      const T h = directionalStepSize( X, v, Marmot::Constants::cbrtEps< T > );
+      return ( F( X + h * v ) - F( X - h * v ) ) / ( T( 2 ) * h );
+    }
 
+    template < typename T >
+    MatrixXt< T > forwardDifference( const vector_to_vector_function_type_t< T >& F, const VectorXt< T >& X )
+    {
+      Workspace     workspace;
+      MatrixXt< T > J( X.size(), X.size() );
+      forwardDifference< T >( F, X, J, workspace );
       return J;
     }
 
+    template < typename T >
+    MatrixXt< T > centralDifference( const vector_to_vector_function_type_t< T >& F, const VectorXt< T >& X )
+    {
+      Workspace     workspace;
+      MatrixXt< T > J( X.size(), X.size() );
+      centralDifference< T >( F, X, J, workspace );
+      return J;
+    }
+
+    double forwardDifference( const scalar_to_scalar_function_type& f, const double x )
+    {
+      return forwardDifference< double >( f, x );
+    }
+
+    double centralDifference( const scalar_to_scalar_function_type& f, const double x )
+    {
+      return centralDifference< double >( f, x );
+    }
+
+    MatrixXd forwardDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+    {
+      return forwardDifference< double >( F, X );
+    }
+
+    MatrixXd centralDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+    {
+      return centralDifference< double >( F, X );
+    }
+
+    VectorXd forwardDifferenceJvp( const vector_to_vector_function_type& F, const VectorXd& X, const VectorXd& v )
+    {
+      return forwardDifferenceJvp< double >( F, X, v );
+    }
+
+    VectorXd forwardDifferenceJvp( const vector_to_vector_function_type& F,
+                                   const VectorXd&                       X,
+                                   const VectorXd&                       FX,
+                                   const VectorXd&                       v )
+    {
+      return forwardDifferenceJvp< double >( F, X, FX, v );
+    }
+
+    VectorXd centralDifferenceJvp( const vector_to_vector_function_type& F, const VectorXd& X, const VectorXd& v )
+    {
+      return centralDifferenceJvp< double >( F, X, v );
+    }
+
     namespace Complex {
       /*
        * Implementation of Numerical Differantiation using Complex Step Approximations
@@ -79,105 +206,258 @@ namespace Marmot {
        *   - Lai et al. (2005) New Complex-Step Derivative Approximations ...
        *
        */
-      double forwardDifference( const scalar_to_scalar_function_type& f, const double x )
+      template < typename T >
+      T forwardDifference( const scalar_to_scalar_function_type_t< T >& f, const T x )
       {
-        complexDouble x_  = complexDouble( x ) + 1e-20 * imaginaryUnit;
-        const double  out = f( x_ ).imag() / 1e-20;
+        MARMOT_PROFILE_SCOPE( "Differentiation::Complex::forwardDifference" );
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+        const T                 h   = complexStep< T >;
+        const std::complex< T > x_  = std::complex< T >( x, h );
+        const T                 out = f( x_ ).imag() / h;
         return out;
       }
 
-      std::tuple< VectorXd, MatrixXd > forwardDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+      template < typename T >
+      void forwardDifference( const vector_to_vector_function_type_t< T >& F,
+                              const VectorXt< T >&                         X,
+                              Eigen::Ref< VectorXt< T > >                  FX,
+                              Eigen::Ref< MatrixXt< T > >                  J,
+                              Workspace&                                   workspace )
       {
         /*
          * according to Martins et al. (2003) Equ. 6
          * according to Lai et al. (2005) Equ. 7
          */
+        MARMOT_PROFILE_SCOPE( "Differentiation::Complex::forwardDifference" );
+        MARMOT_PROFILE_COUNT_EVALUATIONS( X.size() );
+
         const auto xSize = X.rows();
-        MatrixXd   J( xSize, xSize );
-        VectorXcd  rightX( xSize );
-        VectorXcd  F_( xSize );
+        const T    h     = complexStep< T >;
+        checkJacobianSize( J, xSize );
+
+        VectorXt< std::complex< T > >& rightX = workspace.vector< std::complex< T > >( 0, xSize );
+        VectorXt< std::complex< T > >& F_     = workspace.vector< std::complex< T > >( 1, xSize );
 
         for ( auto i = 0; i < xSize; i++ ) {
-          // double h = std::max( 1.0, std::abs( X( i ) ) ) * 1e-16;
-          rightX = X;
-          rightX( i ) += 1e-20 * imaginaryUnit;
+          rightX = X.template cast< std::complex< T > >();
+          rightX( i ) += std::complex< T >( 0, h );
           F_         = F( rightX );
-          J.col( i ) = F_.imag() / 1e-20;
+          J.col( i ) = F_.imag() / h;
         }
 
-        return { F_.real(), J };
+        FX = F_.real();
       }
 
-      MatrixXd centralDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+      template < typename T >
+      void centralDifference( const vector_to_vector_function_type_t< T >& F,
+                              const VectorXt< T >&                         X,
+                              Eigen::Ref< MatrixXt< T > >                  J,
+                              Workspace&                                   workspace )
       {
         /*
          * according to Lai et al. (2005) Equ. 19
          */
+        MARMOT_PROFILE_SCOPE( "Differentiation::Complex::centralDifference" );
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 2 * X.size() );
+
         const auto xSize = X.rows();
-        MatrixXd   J( xSize, xSize );
-        VectorXcd  e( xSize );
-        VectorXcd  rightX( xSize );
-        VectorXcd  leftX( xSize );
+        checkJacobianSize( J, xSize );
 
-        complexDouble i_ = Marmot::Constants::sqrt2 / 2. * complexUnit;
+        VectorXt< std::complex< T > >& rightX = workspace.vector< std::complex< T > >( 0, xSize );
+        VectorXt< std::complex< T > >& leftX  = workspace.vector< std::complex< T > >( 1, xSize );
 
-        for ( auto i = 0; i < xSize; i++ ) {
-          double h = std::max( 1.0, std::abs( X( i ) ) ) * Marmot::Constants::SquareRootEps;
+        const std::complex< T > i_ = std::sqrt( T( 2 ) ) / T( 2 ) * std::complex< T >( 1, 1 );
 
-          e.setZero();
-          e( i ) = 1.;
+        for ( auto i = 0; i < xSize; i++ ) {
+          T h = std::max( T( 1 ), std::abs( X( i ) ) ) * Marmot::Constants::sqrtEps< T >;
 
-          leftX = X;
-          leftX -= e * i_ * h;
+          leftX = X.template cast< std::complex< T > >();
+          leftX( i ) -= i_ * h;
 
-          rightX = X;
-          rightX += e * i_ * h;
+          rightX = X.template cast< std::complex< T > >();
+          rightX( i ) += i_ * h;
 
           // clang-format off
-          J.col( i ) =      ( F( rightX ) - F( leftX )  ).imag() 
+          J.col( i ) =      ( F( rightX ) - F( leftX )  ).imag()
                        / //--------------------------------------
-                              ( Marmot::Constants::sqrt2 * h );
+                              ( std::sqrt( T( 2 ) ) * h );
 
           // clang-format on
         }
-        return J;
       }
 
-      MatrixXd fourthOrderAccurateDerivative( const vector_to_vector_function_type& F, const VectorXd& X )
+      template < typename T >
+      void fourthOrderAccurateDerivative( const vector_to_vector_function_type_t< T >& F,
+                                          const VectorXt< T >&                         X,
+                                          Eigen::Ref< MatrixXt< T > >                  J,
+                                          Workspace&                                   workspace )
       {
         /*
          * according to Lai et al. (2005) Equ. 24
          */
+        MARMOT_PROFILE_SCOPE( "Differentiation::Complex::fourthOrderAccurateDerivative" );
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 4 * X.size() );
+
         const auto xSize = X.rows();
-        MatrixXd   J( xSize, xSize );
-        VectorXcd  complex_X( X );
-        VectorXcd  e( xSize );
-        VectorXcd  x1_( xSize );
-        VectorXcd  x2_( xSize );
-        VectorXcd  x3_( xSize );
-        VectorXcd  x4_( xSize );
+        checkJacobianSize( J, xSize );
 
-        for ( auto i = 0; i < xSize; i++ ) {
-          double h = std::max( 1.0, std::abs( X( i ) ) ) * Marmot::Constants::SquareRootEps;
-          e.setZero();
-          e( i ) = 1.;
+        VectorXt< std::complex< T > >& x1_ = workspace.vector< std::complex< T > >( 0, xSize );
+        VectorXt< std::complex< T > >& x2_ = workspace.vector< std::complex< T > >( 1, xSize );
+        VectorXt< std::complex< T > >& x3_ = workspace.vector< std::complex< T > >( 2, xSize );
+        VectorXt< std::complex< T > >& x4_ = workspace.vector< std::complex< T > >( 3, xSize );
 
-          x1_ = complex_X + e / 2. * i_ * h;
-          x2_ = complex_X - e / 2. * i_ * h;
-          x3_ = complex_X + e * i_ * h;
-          x4_ = complex_X - e * i_ * h;
+        const std::complex< T > i_ = std::sqrt( T( 2 ) ) / T( 2 ) * std::complex< T >( 1, 1 );
+
+        for ( auto i = 0; i < xSize; i++ ) {
+          T h = std::max( T( 1 ), std::abs( X( i ) ) ) * Marmot::Constants::sqrtEps< T >;
+          x1_ = X.template cast< std::complex< T > >();
+          x2_ = x1_;
+          x3_ = x1_;
+          x4_ = x1_;
+          x1_( i ) += i_ * h / T( 2 );
+          x2_( i ) -= i_ * h / T( 2 );
+          x3_( i ) += i_ * h;
+          x4_( i ) -= i_ * h;
 
           // clang-format off
-          J.col( i ) = ( 8.* ( F( x1_ ) - F( x2_ ) ) 
-                           - ( F( x3_ ) - F( x4_ ) ) ).imag() 
-                           / ( Marmot::Constants::sqrt2 * 3. * h );
+          J.col( i ) = ( T( 8 ) * ( F( x1_ ) - F( x2_ ) )
+                                - ( F( x3_ ) - F( x4_ ) ) ).imag()
+                           / ( std::sqrt( T( 2 ) ) * 3 * h );
 
           // clang-format on
         }
+      }
+
+      template < typename T >
+      std::tuple< VectorXt< T >, VectorXt< T > > forwardDifferenceJvp( const vector_to_vector_function_type_t< T >& F,
+                                                                       const VectorXt< T >&                         X,
+                                                                       const VectorXt< T >&                         v )
+      {
+        MARMOT_PROFILE_SCOPE( "Differentiation::Complex::forwardDifferenceJvp" );
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 1 );
+
+        checkDirectionSize( v, X.size() );
+        const T                             h  = complexStep< T >;
+        const VectorXt< std::complex< T > > X_ = X.template cast< std::complex< T > >() +
+                                                 std::complex< T >( 0, h ) * v.template cast< std::complex< T > >();
+        const VectorXt< std::complex< T > > F_ = F( X_ );
+        return { F_.real(), F_.imag() / h };
+      }
+
+      template < typename T >
+      std::tuple< VectorXt< T >, MatrixXt< T > > forwardDifference( const vector_to_vector_function_type_t< T >& F,
+                                                                    const VectorXt< T >&                         X )
+      {
+        Workspace     workspace;
+        VectorXt< T > FX( X.size() );
+        MatrixXt< T > J( X.size(), X.size() );
+        forwardDifference< T >( F, X, FX, J, workspace );
+        return { FX, J };
+      }
 
+      template < typename T >
+      MatrixXt< T > centralDifference( const vector_to_vector_function_type_t< T >& F, const VectorXt< T >& X )
+      {
+        Workspace     workspace;
+        MatrixXt< T > J( X.size(), X.size() );
+        centralDifference< T >( F, X, J, workspace );
         return J;
       }
+
+      template < typename T >
+      MatrixXt< T > fourthOrderAccurateDerivative( const vector_to_vector_function_type_t< T >& F,
+                                                   const VectorXt< T >&                         X )
+      {
+        Workspace     workspace;
+        MatrixXt< T > J( X.size(), X.size() );
+        fourthOrderAccurateDerivative< T >( F, X, J, workspace );
+        return J;
+      }
+
+      double forwardDifference( const scalar_to_scalar_function_type& f, const double x )
+      {
+        return forwardDifference< double >( f, x );
+      }
+
+      std::tuple< VectorXd, MatrixXd > forwardDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+      {
+        return forwardDifference< double >( F, X );
+      }
+
+      MatrixXd centralDifference( const vector_to_vector_function_type& F, const VectorXd& X )
+      {
+        return centralDifference< double >( F, X );
+      }
+
+      MatrixXd fourthOrderAccurateDerivative( const vector_to_vector_function_type& F, const VectorXd& X )
+      {
+        return fourthOrderAccurateDerivative< double >( F, X );
+      }
+
+      std::tuple< VectorXd, VectorXd > forwardDifferenceJvp( const vector_to_vector_function_type& F,
+                                                             const VectorXd&                       X,
+                                                             const VectorXd&                       v )
+      {
+        return forwardDifferenceJvp< double >( F, X, v );
+      }
     } // namespace Complex
 
+    // clang-format off
+#define MARMOT_INSTANTIATE_DIFFERENTIATION( T )                                                                        \
+    template T forwardDifference< T >( const scalar_to_scalar_function_type_t< T >&, const T );                        \
+    template T centralDifference< T >( const scalar_to_scalar_function_type_t< T >&, const T );                        \
+    template MatrixXt< T > forwardDifference< T >( const vector_to_vector_function_type_t< T >&,                       \
+                                                   const VectorXt< T >& );                                             \
+    template MatrixXt< T > centralDifference< T >( const vector_to_vector_function_type_t< T >&,                       \
+                                                   const VectorXt< T >& );                                             \
+    template void forwardDifference< T >( const vector_to_vector_function_type_t< T >&,                                \
+                                          const VectorXt< T >&,                                                        \
+                                          Eigen::Ref< MatrixXt< T > >,                                                 \
+                                          Workspace& );                                                                \
+    template void centralDifference< T >( const vector_to_vector_function_type_t< T >&,                                \
+                                          const VectorXt< T >&,                                                        \
+                                          Eigen::Ref< MatrixXt< T > >,                                                 \
+                                          Workspace& );                                                                \
+    template VectorXt< T > forwardDifferenceJvp< T >( const vector_to_vector_function_type_t< T >&,                    \
+                                                      const VectorXt< T >&,                                            \
+                                                      const VectorXt< T >& );                                          \
+    template VectorXt< T > forwardDifferenceJvp< T >( const vector_to_vector_function_type_t< T >&,                    \
+                                                      const VectorXt< T >&,                                            \
+                                                      const VectorXt< T >&,                                            \
+                                                      const VectorXt< T >& );                                          \
+    template VectorXt< T > centralDifferenceJvp< T >( const vector_to_vector_function_type_t< T >&,                    \
+                                                      const VectorXt< T >&,                                            \
+                                                      const VectorXt< T >& );                                          \
+    template T Complex::forwardDifference< T >( const Complex::scalar_to_scalar_function_type_t< T >&, const T );      \
+    template std::tuple< VectorXt< T >, MatrixXt< T > > Complex::forwardDifference< T >(                               \
+      const Complex::vector_to_vector_function_type_t< T >&, const VectorXt< T >& );                                   \
+    template MatrixXt< T > Complex::centralDifference< T >( const Complex::vector_to_vector_function_type_t< T >&,     \
+                                                            const VectorXt< T >& );                                    \
+    template MatrixXt< T > Complex::fourthOrderAccurateDerivative< T >(                                                \
+      const Complex::vector_to_vector_function_type_t< T >&, const VectorXt< T >& );                                   \
+    template void Complex::forwardDifference< T >( const Complex::vector_to_vector_function_type_t< T >&,              \
+                                                   const VectorXt< T >&,                                               \
+                                                   Eigen::Ref< VectorXt< T > >,                                        \
+                                                   Eigen::Ref< MatrixXt< T > >,                                        \
+                                                   Workspace& );                                                       \
+    template void Complex::centralDifference< T >( const Complex::vector_to_vector_function_type_t< T >&,              \
+                                                   const VectorXt< T >&,                                               \
+                                                   Eigen::Ref< MatrixXt< T > >,                                        \
+                                                   Workspace& );                                                       \
+    template void Complex::fourthOrderAccurateDerivative< T >( const Complex::vector_to_vector_function_type_t< T >&,  \
+                                                               const VectorXt< T >&,                                   \
+                                                               Eigen::Ref< MatrixXt< T > >,                            \
+                                                               Workspace& );                                           \
+    template std::tuple< VectorXt< T >, VectorXt< T > > Complex::forwardDifferenceJvp< T >(                            \
+      const Complex::vector_to_vector_function_type_t< T >&, const VectorXt< T >&, const VectorXt< T >& );
+    // clang-format on
+
+    MARMOT_INSTANTIATE_DIFFERENTIATION( float )
+    MARMOT_INSTANTIATE_DIFFERENTIATION( double )
+    MARMOT_INSTANTIATE_DIFFERENTIATION( long double )
+
+#undef MARMOT_INSTANTIATE_DIFFERENTIATION
+
   } // namespace NumericalAlgorithms::Differentiation
 } // namespace Marmot
@@ -1,43 +1,70 @@
 #include "Marmot/MarmotNumericalIntegration.h"
-#include <iostream>
-#include <iterator>
+#include "Marmot/MarmotProfiling.h"
+#include <stdexcept>
 
 namespace Marmot {
   namespace NumericalAlgorithms::Integration {
 
-    double integrateScalarFunction( scalar_to_scalar_function_type     f,
-                                    const std::tuple< double, double > integrationLimits,
-                                    const int                          n,
-                                    const integrationRule              intRule )
+    template < typename T >
+    T integrateScalarFunction( const scalar_to_scalar_function_type_t< T >& f,
+                               const std::tuple< T, T >                     integrationLimits,
+                               const int                                    n,
+                               const integrationRule                        intRule )
     {
+      MARMOT_PROFILE_SCOPE( "Integration::integrateScalarFunction" );
 
-      // create linear spacing
-      double deltaX = ( std::get< 1 >( integrationLimits ) - std::get< 0 >( integrationLimits ) ) / ( n );
-      std::vector< double > xValues( n + 1 );
+      // linear spacing, evaluated on the fly to avoid a heap allocated grid
+      const T    x0     = std::get< 0 >( integrationLimits );
+      const T    deltaX = ( std::get< 1 >( integrationLimits ) - x0 ) / ( n );
+      const auto x      = [x0, deltaX]( int i ) { return x0 + i * deltaX; };
 
-      std::generate( xValues.begin(), xValues.end(), [n = 0, &deltaX]() mutable { return n++ * deltaX; } );
-      double val = 0.;
+      T val = 0.;
 
       switch ( intRule ) {
       case integrationRule::midpoint:
+        MARMOT_PROFILE_COUNT_EVALUATIONS( n );
         for ( int i = 0; i < n; i++ ) {
-          val += f( ( xValues[i + 1] + xValues[i] ) / 2. ) * deltaX;
+          val += f( ( x( i + 1 ) + x( i ) ) / 2 ) * deltaX;
         }
         break;
       case integrationRule::trapezodial:
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 2 * n );
         for ( int i = 0; i < n; i++ ) {
-          val += ( f( xValues[i + 1] ) + f( xValues[i] ) ) / 2. * deltaX;
+          val += ( f( x( i + 1 ) ) + f( x( i ) ) ) / 2 * deltaX;
         }
         break;
       case integrationRule::simpson:
+        MARMOT_PROFILE_COUNT_EVALUATIONS( 3 * n );
         for ( int i = 0; i < n; i++ ) {
-          val += deltaX / 6. *
-                 ( f( xValues[i] ) + 4 * f( ( xValues[i + 1] + xValues[i] ) / 2. ) + f( xValues[i + 1] ) );
+          val += deltaX / 6 * ( f( x( i ) ) + 4 * f( ( x( i + 1 ) + x( i ) ) / 2 ) + f( x( i + 1 ) ) );
         }
         break;
       default: throw std::invalid_argument( "Invalid integration rule!" );
       }
       return val;
     }
+
+    double integrateScalarFunction( const scalar_to_scalar_function_type& f,
+                                    const std::tuple< double, double >    integrationLimits,
+                                    const int                             n,
+                                    const integrationRule                 intRule )
+    {
+      return integrateScalarFunction< double >( f, integrationLimits, n, intRule );
+    }
+
+    template float integrateScalarFunction< float >( const scalar_to_scalar_function_type_t< float >&,
+                                                     const std::tuple< float, float >,
+                                                     const int,
+                                                     const integrationRule );
+
+    template double integrateScalarFunction< double >( const scalar_to_scalar_function_type_t< double >&,
+                                                       const std::tuple< double, double >,
+                                                       const int,
+                                                       const integrationRule );
+
+    template long double integrateScalarFunction< long double >( const scalar_to_scalar_function_type_t< long double >&,
+                                                                 const std::tuple< long double, long double >,
+                                                                 const int,
+                                                                 const integrationRule );
   } // namespace NumericalAlgorithms::Integration
 } // namespace Marmot
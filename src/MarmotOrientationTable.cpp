@@ -0,0 +1,106 @@
+#include "Marmot/MarmotOrientationTable.h"
+#include "Marmot/MarmotMath.h"
+
+using namespace Eigen;
+
+namespace Marmot::Math {
+
+  // Voigt index to tensor indices according to ( 11, 22, 33, 12, 13, 23 )
+  constexpr int voigtI[6] = { 0, 1, 2, 0, 0, 1 };
+  constexpr int voigtJ[6] = { 0, 1, 2, 1, 2, 2 };
+
+  Matrix6d voigtStressTransformation( const Matrix3d& Q )
+  {
+    // sigma'_ij = Q_ik Q_jl sigma_kl, with both shear components sigma_kl = sigma_lk collected in one column
+    Matrix6d T;
+    for ( int a = 0; a < 6; a++ ) {
+      const int i = voigtI[a], j = voigtJ[a];
+      for ( int b = 0; b < 6; b++ ) {
+        const int k = voigtI[b], l = voigtJ[b];
+        T( a, b )   = k == l ? Q( i, k ) * Q( j, k ) : Q( i, k ) * Q( j, l ) + Q( i, l ) * Q( j, k );
+      }
+    }
+    return T;
+  }
+
+  Matrix6d voigtStrainTransformation( const Matrix3d& Q )
+  {
+    // engineering shear strains: rows of shear components are doubled, columns of shear components are halved
+    Matrix6d T = voigtStressTransformation( Q );
+    T.bottomRows< 3 >() *= 2.;
+    T.rightCols< 3 >() *= 0.5;
+    return T;
+  }
+
+  OrientationTable::OrientationTable( const std::vector< Matrix3d >& coordinateSystems )
+    : coordinateSystems( coordinateSystems ),
+      stressTransformations( 6 * coordinateSystems.size(), 6 ),
+      strainTransformations( 6 * coordinateSystems.size(), 6 )
+  {
+    directionCosines_.reserve( coordinateSystems.size() );
+
+    for ( int i = 0; i < size(); i++ ) {
+      directionCosines_.push_back( Math::directionCosines( coordinateSystems[i] ) );
+      stressTransformations.middleRows< 6 >( 6 * i ) = voigtStressTransformation( directionCosines_[i] );
+      strainTransformations.middleRows< 6 >( 6 * i ) = voigtStrainTransformation( directionCosines_[i] );
+    }
+  }
+
+  OrientationTable OrientationTable::fromNormals( const Matrix< double, 3, Dynamic >& normals )
+  {
+    std::vector< Matrix3d > coordinateSystems;
+    coordinateSystems.reserve( normals.cols() );
+
+    for ( int i = 0; i < normals.cols(); i++ ) {
+      Vector3d n = normals.col( i );
+      coordinateSystems.push_back( orthonormalCoordinateSystem( n ) );
+    }
+
+    return OrientationTable( coordinateSystems );
+  }
+
+  void OrientationTable::rotateStressIn( const Vector6d& globalStress, Matrix6Xd& localStresses ) const
+  {
+    localStresses.resize( 6, size() );
+    Map< VectorXd >( localStresses.data(), 6 * size() ).noalias() = stressTransformations * globalStress;
+  }
+
+  OrientationTable::Matrix6Xd OrientationTable::rotateStressIn( const Vector6d& globalStress ) const
+  {
+    Matrix6Xd localStresses;
+    rotateStressIn( globalStress, localStresses );
+    return localStresses;
+  }
+
+  void OrientationTable::rotateStrainIn( const Vector6d& globalStrain, Matrix6Xd& localStrains ) const
+  {
+    localStrains.resize( 6, size() );
+    Map< VectorXd >( localStrains.data(), 6 * size() ).noalias() = strainTransformations * globalStrain;
+  }
+
+  OrientationTable::Matrix6Xd OrientationTable::rotateStrainIn( const Vector6d& globalStrain ) const
+  {
+    Matrix6Xd localStrains;
+    rotateStrainIn( globalStrain, localStrains );
+    return localStrains;
+  }
+
+  Vector6d OrientationTable::rotateStressOut( const Matrix6Xd& localStresses, const VectorXd& weights ) const
+  {
+    // T_sigma^-1 = T_epsilon^T
+    Vector6d globalStress = Vector6d::Zero();
+    for ( int i = 0; i < size(); i++ )
+      globalStress.noalias() += weights( i ) * strainTransformation( i ).transpose() * localStresses.col( i );
+    return globalStress;
+  }
+
+  Vector6d OrientationTable::rotateStrainOut( const Matrix6Xd& localStrains, const VectorXd& weights ) const
+  {
+    // T_epsilon^-1 = T_sigma^T
+    Vector6d globalStrain = Vector6d::Zero();
+    for ( int i = 0; i < size(); i++ )
+      globalStrain.noalias() += weights( i ) * stressTransformation( i ).transpose() * localStrains.col( i );
+    return globalStrain;
+  }
+
+} // namespace Marmot::Math
@@ -0,0 +1,131 @@
+#include "Marmot/MarmotProfiling.h"
+
+#ifdef MARMOT_ENABLE_PROFILING
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Marmot::Profiling {
+
+  namespace {
+    std::mutex                                     registryMutex;
+    std::array< const char*, maxRegions >          regionNames = {};
+    int                                            nRegions    = 0;
+    std::vector< std::unique_ptr< ThreadRecord > > threads;
+    std::size_t                                    traceEventsPerThread = 0;
+    const std::int64_t                             origin               = now();
+
+    void resetRecord( ThreadRecord& record )
+    {
+      for ( auto& counters : record.regions ) {
+        counters.calls.store( 0, std::memory_order_relaxed );
+        counters.functionEvaluations.store( 0, std::memory_order_relaxed );
+        counters.allocations.store( 0, std::memory_order_relaxed );
+        counters.nanoseconds.store( 0, std::memory_order_relaxed );
+      }
+      record.traceSize.store( 0, std::memory_order_relaxed );
+    }
+  } // namespace
+
+  int registerRegion( const char* name )
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+
+    for ( int i = 0; i < nRegions; i++ )
+      if ( std::strcmp( regionNames[i], name ) == 0 )
+        return i;
+
+    if ( nRegions == maxRegions )
+      throw std::invalid_argument( "Profiling: too many regions, increase maxRegions" );
+
+    regionNames[nRegions] = name;
+    return nRegions++;
+  }
+
+  ThreadRecord& registerThread()
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+
+    auto record      = std::make_unique< ThreadRecord >();
+    record->threadId = static_cast< int >( threads.size() );
+    resetRecord( *record );
+    record->traceCapacity = traceEventsPerThread;
+    if ( traceEventsPerThread > 0 )
+      record->trace = std::make_unique< TraceEvent[] >( traceEventsPerThread );
+
+    activeThread = record.get();
+    threads.push_back( std::move( record ) );
+
+    return *activeThread;
+  }
+
+  void enableTrace( std::size_t eventsPerThread )
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+    traceEventsPerThread = eventsPerThread;
+  }
+
+  void reset()
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+    for ( auto& record : threads )
+      resetRecord( *record );
+  }
+
+  void writeJSON( std::ostream& out )
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+
+    out << "{\n  \"threads\": " << threads.size() << ",\n  \"regions\": [";
+
+    bool first = true;
+    for ( int i = 0; i < nRegions; i++ ) {
+      std::uint64_t calls = 0, functionEvaluations = 0, allocations = 0, nanoseconds = 0;
+      for ( const auto& record : threads ) {
+        const RegionCounters& counters = record->regions[i];
+        calls += counters.calls.load( std::memory_order_relaxed );
+        functionEvaluations += counters.functionEvaluations.load( std::memory_order_relaxed );
+        allocations += counters.allocations.load( std::memory_order_relaxed );
+        nanoseconds += counters.nanoseconds.load( std::memory_order_relaxed );
+      }
+
+      out << ( first ? "\n" : ",\n" );
+      first = false;
+      out << "    {\"name\": \"" << regionNames[i] << "\", \"calls\": " << calls
+          << ", \"functionEvaluations\": " << functionEvaluations << ", \"allocations\": " << allocations
+          << ", \"totalTime_ns\": " << nanoseconds << "}";
+    }
+
+    out << "\n  ]\n}\n";
+  }
+
+  void writeChromeTrace( std::ostream& out )
+  {
+    std::lock_guard< std::mutex > lock( registryMutex );
+
+    const auto flags     = out.flags();
+    const auto precision = out.precision( 3 );
+    out << std::fixed << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+    bool first = true;
+    for ( const auto& record : threads ) {
+      const std::size_t n = record->traceSize.load( std::memory_order_acquire );
+      for ( std::size_t k = 0; k < n; k++ ) {
+        const TraceEvent& event = record->trace[k];
+        out << ( first ? "\n" : ",\n" );
+        first = false;
+        // timestamps in microseconds
+        out << "  {\"name\": \"" << regionNames[event.region] << "\", \"cat\": \"Marmot\", \"ph\": \"X\", \"pid\": 0"
+            << ", \"tid\": " << record->threadId << ", \"ts\": " << ( event.start - origin ) * 1e-3
+            << ", \"dur\": " << event.duration * 1e-3 << "}";
+      }
+    }
+
+    out << "\n]}\n";
+    out.flags( flags );
+    out.precision( precision );
+  }
+
+} // namespace Marmot::Profiling
+#endif
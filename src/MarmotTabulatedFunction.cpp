@@ -0,0 +1,76 @@
+#include "Marmot/MarmotTabulatedFunction.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace Marmot::Math {
+
+  TabulatedFunction::TabulatedFunction( std::vector< double > x,
+                                        std::vector< double > y,
+                                        Interpolation         interpolation,
+                                        Extrapolation         extrapolation )
+    : x_( std::move( x ) ), y_( std::move( y ) ), extrapolation( extrapolation )
+  {
+    if ( x_.size() != y_.size() || x_.size() < 2 )
+      throw std::invalid_argument( "TabulatedFunction: x and y must be of equal size with at least two points" );
+
+    const size_t          n = x_.size();
+    std::vector< double > secants( n - 1 );
+    for ( size_t i = 0; i < n - 1; i++ ) {
+      if ( !( x_[i + 1] > x_[i] ) )
+        throw std::invalid_argument( "TabulatedFunction: x must be strictly increasing" );
+      secants[i] = ( y_[i + 1] - y_[i] ) / ( x_[i + 1] - x_[i] );
+    }
+
+    coefficients.resize( n - 1 );
+    slopes.resize( n );
+    slopes.front() = secants.front();
+    slopes.back()  = secants.back();
+
+    if ( interpolation == Interpolation::linear ) {
+      for ( size_t i = 0; i < n - 1; i++ )
+        coefficients[i] = { y_[i], secants[i], 0., 0. };
+      return;
+    }
+
+    // weighted harmonic mean of the adjacent secants (Fritsch and Butland), zero at local extrema; this satisfies the
+    // monotonicity conditions of Fritsch and Carlson
+    for ( size_t i = 1; i < n - 1; i++ ) {
+      const double hLeft  = x_[i] - x_[i - 1];
+      const double hRight = x_[i + 1] - x_[i];
+      if ( secants[i - 1] * secants[i] <= 0 )
+        slopes[i] = 0;
+      else {
+        const double wLeft  = 2 * hRight + hLeft;
+        const double wRight = hRight + 2 * hLeft;
+        slopes[i]           = ( wLeft + wRight ) / ( wLeft / secants[i - 1] + wRight / secants[i] );
+      }
+    }
+
+    for ( size_t i = 0; i < n - 1; i++ ) {
+      const double h  = x_[i + 1] - x_[i];
+      const double m0 = slopes[i];
+      const double m1 = slopes[i + 1];
+      coefficients[i] = { y_[i], m0, ( 3 * secants[i] - 2 * m0 - m1 ) / h, ( m0 + m1 - 2 * secants[i] ) / ( h * h ) };
+    }
+  }
+
+  TabulatedFunction TabulatedFunction::uniform( double                x0,
+                                                double                dx,
+                                                std::vector< double > y,
+                                                Interpolation         interpolation,
+                                                Extrapolation         extrapolation )
+  {
+    if ( !( dx > 0 ) )
+      throw std::invalid_argument( "TabulatedFunction: dx must be positive" );
+
+    std::vector< double > x( y.size() );
+    for ( size_t i = 0; i < x.size(); i++ )
+      x[i] = x0 + i * dx;
+
+    TabulatedFunction out( std::move( x ), std::move( y ), interpolation, extrapolation );
+    out.isUniform = true;
+    out.inverseDx = 1. / dx;
+    return out;
+  }
+
+} // namespace Marmot::Math
@@ -0,0 +1,91 @@
+#include "Marmot/MarmotTangentVerification.h"
+#include "Marmot/MarmotProfiling.h"
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+
+using namespace Eigen;
+
+namespace Marmot::NumericalAlgorithms::TangentVerification {
+
+  namespace {
+
+    void checkSizes( const VectorXd& X, const MatrixXd& J, const StochasticCheckOptions& options )
+    {
+      if ( J.cols() != X.size() )
+        throw std::invalid_argument( "checkTangent: number of columns of J does not match the size of X" );
+      if ( options.nProbes < 1 )
+        throw std::invalid_argument( "checkTangent: at least one probe is required" );
+    }
+
+    /**
+     * Random direction with independent entries +-1 */
+    VectorXd rademacher( Index size, std::mt19937& generator )
+    {
+      std::bernoulli_distribution coin;
+      VectorXd                    v( size );
+      for ( Index i = 0; i < size; i++ )
+        v( i ) = coin( generator ) ? 1. : -1.;
+      return v;
+    }
+
+    template < typename DirectionalDerivative >
+    StochasticCheckResult check( const VectorXd&               X,
+                                 const MatrixXd&               J,
+                                 const StochasticCheckOptions& options,
+                                 int                           evaluationsPerProbe,
+                                 DirectionalDerivative         directionalDerivative )
+    {
+      checkSizes( X, J, options );
+
+      std::mt19937          generator( options.seed );
+      StochasticCheckResult result{ true, 0., std::ldexp( 1., -options.nProbes ), 0 };
+
+      for ( int k = 0; k < options.nProbes; k++ ) {
+        const VectorXd v  = rademacher( X.size(), generator );
+        const VectorXd Jv = J * v;
+        const VectorXd dF = directionalDerivative( v );
+        result.nEvaluations += evaluationsPerProbe;
+
+        if ( dF.size() != Jv.size() )
+          throw std::invalid_argument( "checkTangent: number of rows of J does not match the size of F" );
+
+        const double scale = std::max( { Jv.lpNorm< Infinity >(), dF.lpNorm< Infinity >(), 1e-300 } );
+        const double error = ( Jv - dF ).lpNorm< Infinity >() / scale;
+
+        result.maximumRelativeError = std::max( result.maximumRelativeError, error );
+        if ( !( error <= options.relativeTolerance ) )
+          result.passed = false;
+      }
+
+      return result;
+    }
+
+  } // namespace
+
+  StochasticCheckResult checkTangent( const Differentiation::vector_to_vector_function_type& F,
+                                      const VectorXd&                                        X,
+                                      const MatrixXd&                                        J,
+                                      const StochasticCheckOptions&                          options )
+  {
+    MARMOT_PROFILE_SCOPE( "TangentVerification::checkTangent" );
+
+    return check( X, J, options, 2, [&]( const VectorXd& v ) -> VectorXd {
+      return Differentiation::centralDifferenceJvp( F, X, v );
+    } );
+  }
+
+  StochasticCheckResult checkTangentComplexStep( const Differentiation::Complex::vector_to_vector_function_type& F,
+                                                 const VectorXd&                                                 X,
+                                                 const MatrixXd&                                                 J,
+                                                 const StochasticCheckOptions& options )
+  {
+    MARMOT_PROFILE_SCOPE( "TangentVerification::checkTangentComplexStep" );
+
+    return check( X, J, options, 1, [&]( const VectorXd& v ) -> VectorXd {
+      return std::get< 1 >( Differentiation::Complex::forwardDifferenceJvp( F, X, v ) );
+    } );
+  }
+
+} // namespace Marmot::NumericalAlgorithms::TangentVerification
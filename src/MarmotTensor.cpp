@@ -120,18 +120,54 @@ namespace Marmot {
     const EigenTensors::Tensor333d LeviCivita3D = Initialize_LeviCivita3D();
     const EigenTensors::Tensor122d LeviCivita2D = Initialize_LeviCivita2D();
 
+    template < int nDim, typename F >
+    EigenTensors::TensorNNNN< nDim > Initialize_FourthOrder( F entry )
+    {
+      EigenTensors::TensorNNNN< nDim > T;
+
+      for ( int i = 0; i < nDim; i++ )
+        for ( int j = 0; j < nDim; j++ )
+          for ( int k = 0; k < nDim; k++ )
+            for ( int l = 0; l < nDim; l++ ) {
+              T( i, j, k, l ) = entry( i, j, k, l );
+            }
+      return T;
+    }
+
+    template < int nDim >
+    const EigenTensors::TensorNNNN< nDim > OfDimension< nDim >::I2xI2 = Initialize_FourthOrder< nDim >(
+      []( int i, int j, int k, int l ) { return double( d( i, j ) * d( k, l ) ); } );
+
+    template < int nDim >
+    const EigenTensors::TensorNNNN< nDim > OfDimension< nDim >::Isym = Initialize_FourthOrder< nDim >(
+      []( int i, int j, int k, int l ) { return 0.5 * ( d( i, k ) * d( j, l ) + d( i, l ) * d( j, k ) ); } );
+
+    template < int nDim >
+    const EigenTensors::TensorNNNN< nDim > OfDimension< nDim >::Iskew = Initialize_FourthOrder< nDim >(
+      []( int i, int j, int k, int l ) { return 0.5 * ( d( i, k ) * d( j, l ) - d( i, l ) * d( j, k ) ); } );
+
+    template < int nDim >
+    const EigenTensors::TensorNNNN< nDim > OfDimension< nDim >::IFourthOrder = Initialize_FourthOrder< nDim >(
+      []( int i, int j, int k, int l ) { return double( d( i, k ) * d( j, l ) ); } );
+
+    template < int nDim >
+    const EigenTensors::TensorNNNN< nDim > OfDimension< nDim >::IFourthOrderTranspose = Initialize_FourthOrder< nDim >(
+      []( int i, int j, int k, int l ) { return double( d( i, l ) * d( j, k ) ); } );
+
+    template < int nDim >
+    const EigenTensors::TensorNNNN< nDim > OfDimension< nDim >::dDeviatoricStress_dStress =
+      Initialize_FourthOrder< nDim >(
+        []( int i, int j, int k, int l ) { return d( i, k ) * d( j, l ) - 1. / nDim * d( i, j ) * d( k, l ); } );
+
+    template struct OfDimension< 2 >;
+    template struct OfDimension< 3 >;
+
   } // namespace ContinuumMechanics::CommonTensors
 
   namespace ContinuumMechanics::TensorUtility {
     Eigen::Matrix3d dyadicProduct( const Eigen::Vector3d& vector1, const Eigen::Vector3d& vector2 )
     {
-      Eigen::Matrix3d dyade;
-
-      for ( int i = 0; i < vector1.rows(); i++ )
-        for ( int j = 0; j < vector1.rows(); j++ )
-          dyade( i, j ) = vector1( i ) * vector2( j );
-
-      return dyade;
+      return vector1 * vector2.transpose();
     }
   } // namespace ContinuumMechanics::TensorUtility
 } // namespace Marmot
@@ -1,4 +1,5 @@
 #include "Marmot/NewtonConvergenceChecker.h"
+#include "Marmot/MarmotProfiling.h"
 #include <iostream>
 
 using namespace Eigen;
@@ -22,7 +23,7 @@ namespace Marmot::NumericalAlgorithms {
   {
   }
 
-  double NewtonConvergenceChecker::relativeNorm( const VectorXd& increment, const VectorXd& reference )
+  double NewtonConvergenceChecker::relativeNorm( const VectorXd& increment, const VectorXd& reference ) const
   {
     double incNorm = increment.norm();
     double refNorm = reference.norm();
@@ -37,7 +38,7 @@ namespace Marmot::NumericalAlgorithms {
     return increment.norm() / refNorm;
   }
 
-  double NewtonConvergenceChecker::residualNorm( const VectorXd& residual )
+  double NewtonConvergenceChecker::residualNorm( const VectorXd& residual ) const
   {
     return ( residualScaleVector.array() * residual.array() ).matrix().norm();
   }
@@ -45,8 +46,10 @@ namespace Marmot::NumericalAlgorithms {
   bool NewtonConvergenceChecker::iterationFinished( const VectorXd& residual,
                                                     const VectorXd& X,
                                                     const VectorXd& dX,
-                                                    int             numberOfIterations )
+                                                    int             numberOfIterations ) const
   {
+    MARMOT_PROFILE_SCOPE( "NewtonConvergenceChecker::iterationFinished" );
+
     if ( isConverged( residual, X, dX, numberOfIterations ) || numberOfIterations > nMaxNewtonCyclesAlt )
       return true;
     else
@@ -56,8 +59,10 @@ namespace Marmot::NumericalAlgorithms {
   bool NewtonConvergenceChecker::isConverged( const VectorXd& residual,
                                               const VectorXd& X,
                                               const VectorXd& dX,
-                                              int             numberOfIterations )
+                                              int             numberOfIterations ) const
   {
+    MARMOT_PROFILE_SCOPE( "NewtonConvergenceChecker::isConverged" );
+
     const double resNorm = residualNorm( residual );
     const double relNorm = relativeNorm( dX, X );
 
@@ -1,8 +1,17 @@
-# add_executable("TestMarmotNumericalIntegration_executable" "${CMAKE_CURRENT_LIST_DIR}/test/TestMarmotNumericalIntegration.cpp")
-# include_directories("${CMAKE_CURRENT_BINARY_DIR}/../include/" "${INSTALLED_MODULE_PATHS}/include/")
-# target_link_libraries("TestMarmotNumericalIntegration_executable" "${CMAKE_CURRENT_BINARY_DIR}/lib/libMarmot.so")
-# add_dependencies("TestMarmotNumericalIntegration_executable" "${PROJECT_NAME}")
-# add_test(NAME "TestMarmotNumericalIntegration" COMMAND "TestMarmotNumericalIntegration_executable" WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
-# add_executable("MarmotMathCore_executable" "${CMAKE_CURRENT_LIST_DIR}/test/test.cpp")
-# target_link_libraries("MarmotMathCore_executable" Marmot)
-# add_test(NAME "MarmotMathCore" COMMAND "MarmotMathCore_executable")
+foreach( marmotMathCoreTest TestMarmotArena TestMarmotBatch TestMarmotDenseSolvers TestMarmotEigenDecomposition TestMarmotEinsum TestMarmotEventDetection TestMarmotImplicitFunctionTangent TestMarmotImplicitIntegration TestMarmotJacobianVectorProduct TestMarmotMath TestMarmotMemoization TestMarmotNewtonKrylov TestMarmotNumericalIntegration TestMarmotOrientationTable TestMarmotReducedDimensions TestMarmotStressInvariants TestMarmotTabulatedFunction TestMarmotTangentVerification TestMarmotTensor )
+  add_executable( "${marmotMathCoreTest}_executable" "${CMAKE_CURRENT_LIST_DIR}/test/${marmotMathCoreTest}.cpp" )
+  target_link_libraries( "${marmotMathCoreTest}_executable" Marmot )
+  add_test( NAME "${marmotMathCoreTest}" COMMAND "${marmotMathCoreTest}_executable" )
+endforeach()
+
+if( MARMOT_MATHCORE_PROFILING )
+  add_executable( TestMarmotProfiling_executable "${CMAKE_CURRENT_LIST_DIR}/test/TestMarmotProfiling.cpp" )
+  target_link_libraries( TestMarmotProfiling_executable Marmot )
+  add_test( NAME TestMarmotProfiling COMMAND TestMarmotProfiling_executable )
+endif()
+
+if( MARMOT_MATHCORE_ALLOCATION_TRACKING )
+  add_executable( TestMarmotAllocationTracking_executable "${CMAKE_CURRENT_LIST_DIR}/test/TestMarmotAllocationTracking.cpp" )
+  target_link_libraries( TestMarmotAllocationTracking_executable Marmot MarmotAllocationTracking )
+  add_test( NAME TestMarmotAllocationTracking COMMAND TestMarmotAllocationTracking_executable )
+endif()
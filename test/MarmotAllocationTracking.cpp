@@ -0,0 +1,120 @@
+#include "Marmot/MarmotAllocationTracking.h"
+
+#ifdef MARMOT_ENABLE_ALLOCATION_TRACKING
+#include "Marmot/MarmotProfiling.h"
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+namespace Marmot::AllocationTracking {
+
+  namespace {
+    // initial-exec TLS: accessing the counter must not allocate itself
+    thread_local std::uint64_t threadAllocations __attribute__( ( tls_model( "initial-exec" ) ) ) = 0;
+
+    inline void count()
+    {
+      threadAllocations++;
+#ifdef MARMOT_ENABLE_PROFILING
+      Profiling::countAllocations( 1 );
+#endif
+    }
+  } // namespace
+
+  std::uint64_t allocations()
+  {
+    return threadAllocations;
+  }
+
+} // namespace Marmot::AllocationTracking
+
+using Marmot::AllocationTracking::count;
+
+#ifdef __GLIBC__
+// glibc supports replacing malloc by definitions in the program, forwarding to the __libc_* implementations
+extern "C" {
+void* __libc_malloc( std::size_t );
+void* __libc_calloc( std::size_t, std::size_t );
+void* __libc_realloc( void*, std::size_t );
+void* __libc_memalign( std::size_t, std::size_t );
+
+void* malloc( std::size_t size )
+{
+  count();
+  return __libc_malloc( size );
+}
+
+void* calloc( std::size_t n, std::size_t size )
+{
+  count();
+  return __libc_calloc( n, size );
+}
+
+void* realloc( void* ptr, std::size_t size )
+{
+  count();
+  return __libc_realloc( ptr, size );
+}
+
+void* memalign( std::size_t alignment, std::size_t size )
+{
+  count();
+  return __libc_memalign( alignment, size );
+}
+
+void* aligned_alloc( std::size_t alignment, std::size_t size )
+{
+  count();
+  return __libc_memalign( alignment, size );
+}
+
+int posix_memalign( void** ptr, std::size_t alignment, std::size_t size )
+{
+  count();
+  *ptr = __libc_memalign( alignment, size );
+  return *ptr ? 0 : ENOMEM;
+}
+}
+
+// operator new is implemented in terms of the replaced malloc
+void* operator new( std::size_t size )
+{
+  if ( void* ptr = std::malloc( size ? size : 1 ) )
+    return ptr;
+  throw std::bad_alloc();
+}
+#else
+void* operator new( std::size_t size )
+{
+  count();
+  if ( void* ptr = std::malloc( size ? size : 1 ) )
+    return ptr;
+  throw std::bad_alloc();
+}
+#endif
+
+void* operator new[]( std::size_t size )
+{
+  return operator new( size );
+}
+
+void operator delete( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void* ptr ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete( void* ptr, std::size_t ) noexcept
+{
+  std::free( ptr );
+}
+
+void operator delete[]( void* ptr, std::size_t ) noexcept
+{
+  std::free( ptr );
+}
+#endif
@@ -0,0 +1,110 @@
+#include "Marmot/MarmotAllocationTracking.h"
+#include "Marmot/MarmotArena.h"
+#include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotNewtonKrylov.h"
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include "Marmot/MarmotNumericalIntegration.h"
+#include <functional>
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::AllocationTracking;
+
+int main()
+{
+  // the tracking itself must see Eigen's dynamic allocations
+  if ( countAllocations( []() { Eigen::VectorXd x = Eigen::VectorXd::Ones( 6 ); } ) == 0 ) {
+    std::cout << "Allocation tracking failed to detect an allocation" << std::endl;
+    return 1;
+  }
+
+  const Vector6d y0    = ( Vector6d() << 1, 2, 3, 4, 5, 6 ).finished();
+  auto           fRate = []( const Vector6d& y ) -> Vector6d { return -y.cwiseProduct( y ); };
+
+  const Matrix3d stress = ( Matrix3d() << 1, 2, 3, 2, 4, 5, 3, 5, 6 ).finished();
+
+  // hot paths which must not allocate
+  const std::pair< const char*, std::function< void() > > hotPaths[] = {
+    { "Math::explicitEuler", [&]() { Math::explicitEuler( y0, 1e-3, fRate ); } },
+    { "Math::semiImplicitEuler", [&]() { Math::semiImplicitEuler< 6 >( y0, 1e-3, fRate ); } },
+    { "Math::centralDiff", [&]() { Math::centralDiff< 6, 6 >( fRate, y0 ); } },
+    { "Math::explicitEulerRichardsonWithErrorEstimator",
+      [&]() { Math::explicitEulerRichardsonWithErrorEstimator< 6 >( y0, 1e-3, 1e-6, fRate ); } },
+    { "Arena::matrix",
+      []() {
+        Arena::Scope scope;
+        Arena::threadLocal().matrix< double >( 36, 36 ).setZero();
+      } },
+    { "Math::eigenDecompositionSymmetric3x3", [&]() { Math::eigenDecompositionSymmetric3x3( stress ); } },
+    { "Integration::integrateScalarFunction",
+      []() {
+        NumericalAlgorithms::Integration::integrateScalarFunction( []( double x ) { return x * x; },
+                                                                   { 0., 1. },
+                                                                   100,
+                                                                   NumericalAlgorithms::Integration::simpson );
+      } },
+  };
+
+  bool allocationFree = true;
+  for ( const auto& [name, hotPath] : hotPaths ) {
+    // the first call may allocate one-time state, e.g., the thread's record of the profiling counters
+    hotPath();
+
+    const std::uint64_t allocations = countAllocations( hotPath );
+    if ( allocations != 0 ) {
+      std::cout << name << " performed " << allocations << " heap allocations" << std::endl;
+      allocationFree = false;
+    }
+  }
+
+  // with a workspace, the finite difference Jacobian only allocates the results of the dynamic size function itself
+  using namespace Marmot::NumericalAlgorithms::Differentiation;
+  const vector_to_vector_function_type F = []( const Eigen::VectorXd& X ) -> Eigen::VectorXd {
+    return X.array().square();
+  };
+  const Eigen::VectorXd X = y0;
+  Eigen::MatrixXd       J( X.size(), X.size() );
+  Workspace             workspace;
+  centralDifference< double >( F, X, J, workspace );
+
+  const std::uint64_t workspaceAllocations = countAllocations(
+    [&]() { centralDifference< double >( F, X, J, workspace ); } );
+  if ( workspaceAllocations != std::uint64_t( 2 * X.size() ) ) {
+    std::cout << "centralDifference with workspace performed " << workspaceAllocations << " instead of "
+              << 2 * X.size() << " heap allocations" << std::endl;
+    allocationFree = false;
+  }
+
+  // gmres only allocates the results of the matrix-free operators and a single argument vector
+  using namespace Marmot::NumericalAlgorithms::NewtonKrylov;
+  const Eigen::VectorXd diagonal = Eigen::VectorXd::LinSpaced( 40, 1., 40. );
+  const Eigen::VectorXd b        = Eigen::VectorXd::Ones( diagonal.size() );
+  int                   nCalls   = 0;
+
+  const linear_operator_type A = [&]( const Eigen::VectorXd& v ) -> Eigen::VectorXd {
+    nCalls++;
+    return diagonal.cwiseProduct( v ) + 0.1 * v.reverse();
+  };
+  const preconditioner_type M = [&]( const Eigen::VectorXd& r ) -> Eigen::VectorXd {
+    nCalls++;
+    return r.cwiseQuotient( diagonal );
+  };
+
+  Eigen::VectorXd x = Eigen::VectorXd::Zero( b.size() );
+  const GMRESOptions options{ 1e-10, 10, 100 };
+  for ( const auto& preconditioner : { preconditioner_type(), M } ) {
+    x.setZero();
+    gmres( A, b, x, options, preconditioner );
+
+    x.setZero();
+    nCalls                          = 0;
+    const std::uint64_t allocations = countAllocations( [&]() { gmres( A, b, x, options, preconditioner ); } );
+    if ( allocations != std::uint64_t( nCalls + 1 ) ) {
+      std::cout << "gmres performed " << allocations << " heap allocations for " << nCalls << " operator calls"
+                << std::endl;
+      allocationFree = false;
+    }
+  }
+
+  return allocationFree ? 0 : 1;
+}
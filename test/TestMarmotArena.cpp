@@ -0,0 +1,60 @@
+#include "Marmot/MarmotArena.h"
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include "Marmot/MarmotWorkspace.h"
+#include <cstdint>
+#include <iostream>
+
+using namespace Marmot;
+
+int main()
+{
+  Arena arena( 1024 );
+
+  // allocations are aligned and a scope releases them again
+  {
+    Arena::Scope scope( arena );
+    for ( int i = 1; i < 10; i++ ) {
+      auto v = arena.vector< double >( i );
+      if ( reinterpret_cast< std::uintptr_t >( v.data() ) % Arena::alignment != 0 ) {
+        std::cout << "Arena returned misaligned memory" << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  const Arena::Marker begin = arena.mark();
+  if ( begin.block != 0 || begin.offset != 0 ) {
+    std::cout << "Arena::Scope failed to rewind the arena" << std::endl;
+    return 1;
+  }
+
+  // requests larger than the block size get a block of their own, which is reused after a reset
+  arena.matrix< double >( 100, 100 );
+  const std::size_t capacity = arena.capacity();
+  arena.reset();
+  arena.matrix< double >( 100, 100 );
+  if ( arena.capacity() != capacity ) {
+    std::cout << "Arena failed to reuse its blocks" << std::endl;
+    return 1;
+  }
+
+  // Marmot routines write their results directly into arena memory
+  using namespace Marmot::NumericalAlgorithms::Differentiation;
+  const vector_to_vector_function_type F = []( const Eigen::VectorXd& X ) -> Eigen::VectorXd {
+    return X.array().square();
+  };
+  const Eigen::VectorXd X = Eigen::VectorXd::LinSpaced( 5, 1, 5 );
+
+  Workspace    workspace;
+  Arena::Scope scope;
+  auto         J = Arena::threadLocal().matrix< double >( X.size(), X.size() );
+  centralDifference< double >( F, X, J, workspace );
+
+  const Eigen::MatrixXd JExact = Eigen::MatrixXd( ( 2 * X ).asDiagonal() );
+  if ( ( J - JExact ).norm() > 1e-8 ) {
+    std::cout << "centralDifference into arena memory failed: " << std::endl << J << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
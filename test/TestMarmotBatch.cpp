@@ -0,0 +1,85 @@
+#include "Marmot/MarmotBatch.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::ContinuumMechanics::TensorUtility;
+
+namespace {
+
+  bool check( const std::string& name, Eigen::Index lane, double value, double reference )
+  {
+    if ( std::abs( value - reference ) > 1e-12 * std::max( 1., std::abs( reference ) ) ) {
+      std::cout << name << " differs in lane " << lane << ": " << value << " != " << reference << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  template < typename T >
+  bool check( const std::string& name, Eigen::Index lane, const T& value, const T& reference )
+  {
+    if ( !value.isApprox( reference, 1e-12 ) ) {
+      std::cout << name << " differs in lane " << lane << ":\n" << value << "\n!=\n" << reference << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Compares each batched kernel lane by lane against the scalar Eigen result */
+  template < int K >
+  bool testKernels( Eigen::Index nLanes )
+  {
+    BatchVector3d< K > a( nLanes );
+    BatchVector3d< K > b( nLanes );
+    BatchMatrix3d< K > A( nLanes );
+
+    for ( Eigen::Index k = 0; k < nLanes; k++ ) {
+      a.set( k, Vector3d::Random() );
+      b.set( k, Vector3d::Random() );
+      A.set( k, Matrix3d::Random() + 2 * Matrix3d::Identity() );
+    }
+
+    const BatchMatrix3d< K > ab   = dyadicProduct( a, b );
+    const auto               trA  = trace( A );
+    const BatchMatrix3d< K > devA = deviatoric( A );
+    const auto               detA = determinant( A );
+    const BatchMatrix3d< K > invA = inverse( A );
+    const auto               I1A  = I1( A );
+    const auto               J2A  = J2( A );
+    const auto               J3A  = J3( A );
+    const Matrix3d           I    = Matrix3d::Identity();
+
+    bool passed = ab.lanes() == nLanes && invA.lanes() == nLanes && trA.size() == nLanes;
+
+    for ( Eigen::Index k = 0; k < nLanes; k++ ) {
+      const Matrix3d Ak = A.get( k );
+      const Matrix3d s  = Ak - Ak.trace() / 3. * I;
+
+      passed &= check( "set/get", k, Vector3d( a.get( k ) ), Vector3d( a( 0 )( k ), a( 1 )( k ), a( 2 )( k ) ) );
+      passed &= check( "dyadicProduct", k, ab.get( k ), Matrix3d( a.get( k ) * b.get( k ).transpose() ) );
+      passed &= check( "trace", k, trA( k ), Ak.trace() );
+      passed &= check( "deviatoric", k, devA.get( k ), s );
+      passed &= check( "determinant", k, detA( k ), Ak.determinant() );
+      passed &= check( "inverse", k, invA.get( k ), Matrix3d( Ak.inverse() ) );
+      passed &= check( "I1", k, I1A( k ), Ak.trace() );
+      passed &= check( "J2", k, J2A( k ), 0.5 * ( s * s ).trace() );
+      passed &= check( "J3", k, J3A( k ), s.determinant() );
+    }
+
+    return passed;
+  }
+
+} // namespace
+
+int main()
+{
+  bool passed = true;
+
+  passed &= testKernels< 8 >( 8 );
+  // dynamic batch sizes, including batches which do not fill the packets of the vectorized kernels
+  passed &= testKernels< Eigen::Dynamic >( 5 );
+  passed &= testKernels< Eigen::Dynamic >( 1 );
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#include "Marmot/MarmotDenseSolvers.h"
+#include <array>
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::NumericalAlgorithms::DenseSolvers;
+
+template < int N >
+bool checkSolvers()
+{
+  using Matrix = Eigen::Matrix< double, N, N >;
+  using Vector = Eigen::Matrix< double, N, 1 >;
+
+  // nonsymmetric with a zero diagonal entry to require pivoting, and symmetric positive definite
+  Matrix A = Matrix::Random() + Matrix::Identity();
+  if ( N > 1 )
+    A( 0, 0 ) = 0;
+  const Matrix B = Matrix::Random();
+  const Matrix S = B * B.transpose() + N * Matrix::Identity();
+
+  const Eigen::Matrix< double, N, 3 > rhs = Eigen::Matrix< double, N, 3 >::Random();
+
+  const LU< N >       lu( A );
+  const LDLT< N >     ldlt( S );
+  const Cholesky< N > cholesky( S );
+
+  const double tol = 1e-10;
+  if ( lu.info() != Eigen::Success || ( A * lu.solve( rhs ) - rhs ).norm() > tol ||
+       ( S * ldlt.solve( rhs ) - rhs ).norm() > tol || ( S * cholesky.solve( rhs ) - rhs ).norm() > tol ) {
+    std::cout << "Unrolled solvers failed for N = " << N << std::endl;
+    return false;
+  }
+
+  if ( Cholesky< N >( -S ).info() == Eigen::Success ) {
+    std::cout << "Cholesky failed to detect an indefinite matrix for N = " << N << std::endl;
+    return false;
+  }
+
+  // lanes of independent systems
+  constexpr int           K = 8;
+  Batch< Matrix, K >      ABatch;
+  Batch< Matrix, K >      SBatch;
+  Batch< Vector, K >      bBatch;
+  std::array< Matrix, K > As;
+  std::array< Matrix, K > Ss;
+  for ( int k = 0; k < K; k++ ) {
+    As[k] = Matrix::Random() + Matrix::Identity();
+    if ( N > 1 )
+      As[k]( k % N, k % N ) = 0;
+    const Matrix Bk = Matrix::Random();
+    Ss[k]           = Bk * Bk.transpose() + N * Matrix::Identity();
+    ABatch.set( k, As[k] );
+    SBatch.set( k, Ss[k] );
+    bBatch.set( k, Vector::Random() );
+  }
+
+  const auto xLU       = BatchLU< N, K >( ABatch ).solve( bBatch );
+  const auto xLDLT     = BatchLDLT< N, K >( SBatch ).solve( bBatch );
+  const auto xCholesky = BatchCholesky< N, K >( SBatch ).solve( bBatch );
+
+  for ( int k = 0; k < K; k++ ) {
+    const Vector b = bBatch.get( k );
+    if ( ( As[k] * xLU.get( k ) - b ).norm() > tol || ( Ss[k] * xLDLT.get( k ) - b ).norm() > tol ||
+         ( Ss[k] * xCholesky.get( k ) - b ).norm() > tol ) {
+      std::cout << "Batched solvers failed for N = " << N << " in lane " << k << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+int main()
+{
+  return checkSolvers< 1 >() && checkSolvers< 6 >() && checkSolvers< 9 >() && checkSolvers< 13 >() ? 0 : 1;
+}
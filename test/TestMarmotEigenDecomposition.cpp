@@ -0,0 +1,39 @@
+#include "Marmot/MarmotMath.h"
+#include <iostream>
+
+using namespace Marmot;
+
+int main()
+{
+  // principal stresses of a rotated stress state with two repeated eigenvalues
+  const Matrix3d Q          = Eigen::AngleAxisd( 0.3, Vector3d( 1, 2, 3 ).normalized() ).toRotationMatrix();
+  const Vector3d principals = Vector3d( -2., 5., 5. );
+  const Matrix3d stress     = Q * principals.asDiagonal() * Q.transpose();
+
+  const auto [eigenValues, eigenVectors] = Math::eigenDecompositionSymmetric3x3( stress );
+
+  if ( ( eigenValues - principals ).cwiseAbs().maxCoeff() > 1e-14 ) {
+    std::cout << "Eigenvalues of symmetric 3x3 matrix failed: " << eigenValues.transpose() << std::endl;
+    return 1;
+  }
+
+  if ( ( stress * eigenVectors - eigenVectors * eigenValues.asDiagonal() ).cwiseAbs().maxCoeff() > 1e-14 ||
+       ( eigenVectors.transpose() * eigenVectors - Matrix3d::Identity() ).cwiseAbs().maxCoeff() > 1e-14 ) {
+    std::cout << "Eigenvectors of symmetric 3x3 matrix failed: " << std::endl << eigenVectors << std::endl;
+    return 1;
+  }
+
+  // batched eigenvalues agree with the scalar kernel
+  BatchMatrix3d< 4 > stresses;
+  for ( int k = 0; k < 4; k++ )
+    stresses.set( k, stress * ( k + 1 ) );
+
+  const BatchVector3d< 4 > batchedEigenValues = Math::eigenValuesSymmetric3x3( stresses );
+  for ( int k = 0; k < 4; k++ )
+    if ( ( batchedEigenValues.get( k ) - principals * ( k + 1 ) ).cwiseAbs().maxCoeff() > 1e-12 ) {
+      std::cout << "Batched eigenvalues failed: " << batchedEigenValues.get( k ).transpose() << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
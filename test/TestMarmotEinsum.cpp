@@ -0,0 +1,86 @@
+#include "Marmot/MarmotEinsum.h"
+#include "Marmot/MarmotTensor.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::ContinuumMechanics::TensorUtility;
+using namespace Marmot::ContinuumMechanics::TensorUtility::Einsum;
+
+namespace {
+
+  template < typename TensorA, typename TensorB >
+  double difference( const TensorA& a, const TensorB& b )
+  {
+    const Eigen::Tensor< double, 0 > norm = ( a - b ).abs().maximum();
+    return norm();
+  }
+
+} // namespace
+
+int main()
+{
+  EigenTensors::Tensor3333d A;
+  EigenTensors::Tensor3333d B;
+  EigenTensors::Tensor633d  T;
+  A.setRandom();
+  B.setRandom();
+  T.setRandom();
+  const Eigen::Matrix3d M = Eigen::Matrix3d::Random();
+  const Eigen::Matrix3d W = M - M.transpose();
+
+  using IndexPair = Eigen::IndexPair< int >;
+  using ijkl      = Indices< 'i', 'j', 'k', 'l' >;
+  using klmn      = Indices< 'k', 'l', 'm', 'n' >;
+  using ijmn      = Indices< 'i', 'j', 'm', 'n' >;
+  using ijk       = Indices< 'i', 'j', 'k' >;
+  using kl        = Indices< 'k', 'l' >;
+  using ij        = Indices< 'i', 'j' >;
+  using jk        = Indices< 'j', 'k' >;
+
+  const Eigen::TensorMap< const Eigen::Tensor< double, 2 > > M_( M.data(), 3, 3 );
+  const Eigen::TensorMap< const Eigen::Tensor< double, 2 > > W_( W.data(), 3, 3 );
+
+  // double contraction of a fourth and a second order tensor
+  const Eigen::array< IndexPair, 2 > klPair = { IndexPair( 2, 0 ), IndexPair( 3, 1 ) };
+  const Eigen::Tensor< double, 2 >   AM     = A.contract( M_, klPair );
+  if ( difference( contract< ijkl, kl, ij >( A, M ), AM ) > 1e-14 ) {
+    std::cout << "A_ijkl M_kl failed" << std::endl;
+    return 1;
+  }
+
+  // double contraction of two fourth order tensors
+  const Eigen::Tensor< double, 4 > AB = A.contract( B, klPair );
+  if ( difference( contract< ijkl, klmn, ijmn >( A, B ), AB ) > 1e-14 ) {
+    std::cout << "A_ijkl B_klmn failed" << std::endl;
+    return 1;
+  }
+
+  // third order tensor with a leading Voigt index
+  const Eigen::array< IndexPair, 2 > ijPair = { IndexPair( 1, 0 ), IndexPair( 2, 1 ) };
+  const Eigen::Tensor< double, 1 >   TM     = T.contract( M_, ijPair );
+  if ( difference( contract< Indices< 'A', 'i', 'j' >, ij, Indices< 'A' > >( T, M ), TM ) > 1e-14 ) {
+    std::cout << "T_Aij M_ij failed" << std::endl;
+    return 1;
+  }
+
+  // the compile-time Levi-Civita symbol matches the tabulated one
+  const Eigen::array< IndexPair, 2 > jkPair = { IndexPair( 1, 0 ), IndexPair( 2, 1 ) };
+  const Eigen::Tensor< double, 1 >   w      = ContinuumMechanics::CommonTensors::LeviCivita3D.contract( W_, jkPair );
+  if ( difference( contract< ijk, jk, Indices< 'i' > >( LeviCivita3D(), W ), w ) > 1e-15 ) {
+    std::cout << "e_ijk W_jk failed" << std::endl;
+    return 1;
+  }
+
+  // Kronecker delta, traces and permutations
+  const Eigen::Tensor< double, 2 > MT    = contract< ij, Indices< 'j', 'i' > >( M );
+  const Eigen::Tensor< double, 4 > Aikjl = contract< ijkl, Indices< 'i', 'k', 'j', 'l' > >( A );
+  if ( std::abs( contract< ij, ij, Indices<> >( KroneckerDelta< 3 >(), M ) - M.trace() ) > 1e-15 ||
+       std::abs( contract< Indices< 'i', 'i' >, Indices<> >( M ) - M.trace() ) > 1e-15 ||
+       difference( Aikjl, A.shuffle( Eigen::array< int, 4 >{ 0, 2, 1, 3 } ) ) > 0 ||
+       difference( MT, M_.shuffle( Eigen::array< int, 2 >{ 1, 0 } ) ) > 0 ) {
+    std::cout << "Single operand contractions failed" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+#include "Marmot/MarmotMath.h"
+#include <cmath>
+#include <iostream>
+
+using namespace Marmot::Math;
+
+int main()
+{
+  // y0 = t, y1 = t^2 / 2 are integrated exactly by the Richardson extrapolation and the Hermite interpolant
+  int  nEvaluations = 0;
+  auto fRate        = [&]( const Eigen::Vector2d& y ) -> Eigen::Vector2d {
+    nEvaluations++;
+    return Eigen::Vector2d( 1, y( 0 ) );
+  };
+  auto yieldFunction = []( const Eigen::Vector2d& y ) { return y( 0 ) - 0.75; };
+
+  const auto result = explicitEulerRichardsonWithEventDetection< 2, double >( Eigen::Vector2d::Zero(),
+                                                                              2.,
+                                                                              0.4,
+                                                                              1e-6,
+                                                                              fRate,
+                                                                              yieldFunction );
+
+  if ( !result.eventDetected || std::abs( result.t - 0.75 ) > 1e-14 ||
+       std::abs( result.y( 1 ) - 0.75 * 0.75 / 2 ) > 1e-14 || yieldFunction( result.y ) < 0 ) {
+    std::cout << "Event detection failed: t = " << result.t << ", y = " << result.y.transpose() << std::endl;
+    return 1;
+  }
+
+  // the crossing step is truncated, not repeated, and the rate at the end of a step is reused
+  if ( result.rejectedSteps != 0 || nEvaluations != 2 * result.acceptedSteps + 1 ) {
+    std::cout << "Event detection required " << nEvaluations << " evaluations for " << result.acceptedSteps
+              << " steps and " << result.rejectedSteps << " rejected steps" << std::endl;
+    return 1;
+  }
+
+  // without a crossing, the entire interval is integrated
+  const auto elastic = explicitEulerRichardsonWithEventDetection< 2, double >( Eigen::Vector2d::Zero(),
+                                                                               0.5,
+                                                                               0.4,
+                                                                               1e-6,
+                                                                               fRate,
+                                                                               yieldFunction );
+  if ( elastic.eventDetected || !elastic.converged || elastic.t != 0.5 ) {
+    std::cout << "Integration without event failed: t = " << elastic.t << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include "Marmot/MarmotDenseSolvers.h"
+#include "Marmot/MarmotImplicitFunctionTangent.h"
+#include "Marmot/NewtonConvergenceChecker.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::NumericalAlgorithms;
+
+namespace {
+
+  // local residual R( X, eps ) of internal variables X driven by the strain eps, e.g., of a return mapping
+  const auto residual = []( const auto& X, const auto& eps ) {
+    using std::exp;
+    using Scalar = typename std::decay_t< decltype( X ) >::Scalar;
+    Eigen::Matrix< Scalar, 2, 1 > R;
+    R( 0 ) = X( 0 ) + 0.1 * X( 0 ) * X( 0 ) * X( 0 ) + X( 0 ) * X( 1 ) - ( eps( 0 ) + 2. * eps( 1 ) );
+    R( 1 ) = X( 1 ) + exp( 0.1 * X( 0 ) ) - 1. - eps( 2 ) * eps( 0 );
+    return R;
+  };
+
+  Eigen::Matrix2d dR_dXAt( const Eigen::Vector2d& X, const Eigen::Vector3d& eps )
+  {
+    const Eigen::Matrix< autodiff::dual, 3, 1 > eps_ = eps.cast< autodiff::dual >();
+    return AutomaticDifferentiation::jacobian< 2 >( [&]( const auto& X_ ) { return residual( X_, eps_ ); }, X ).second;
+  }
+
+  const NewtonConvergenceChecker checker( Eigen::VectorXd::Ones( 2 ), 10, 15, 1e-12, 1e-12, 1e-10, 1e-10 );
+
+  Eigen::Vector2d localNewton( const Eigen::Vector3d& eps, DenseSolvers::LU< 2 >& dR_dX )
+  {
+    Eigen::Vector2d X  = Eigen::Vector2d::Zero();
+    Eigen::Vector2d dX = Eigen::Vector2d::Constant( 1. );
+    Eigen::Vector2d R  = residual( X, eps );
+    int             it = 0;
+
+    while ( !checker.iterationFinished( R, X, dX, it ) ) {
+      dR_dX.compute( dR_dXAt( X, eps ) );
+      dX = -dR_dX.solve( R );
+      X += dX;
+      R = residual( X, eps );
+      it++;
+    }
+
+    if ( !checker.isConverged( R, X, dX, it ) )
+      throw std::runtime_error( "local Newton failed to converge" );
+    return X;
+  }
+
+} // namespace
+
+int main()
+{
+  const Eigen::Vector3d eps( 0.8, -0.3, 0.5 );
+
+  DenseSolvers::LU< 2 > dR_dX;
+  const Eigen::Vector2d X       = localNewton( eps, dR_dX );
+  const auto            tangent = implicitFunctionTangent( dR_dX, residual, X, eps );
+
+  // reference: central differences of the complete return map, i.e., two additional Newton solves per column
+  Eigen::Matrix< double, 2, 3 > reference;
+  const double                  h = 1e-6;
+  for ( int j = 0; j < 3; j++ ) {
+    DenseSolvers::LU< 2 > unused;
+    Eigen::Vector3d       epsPlus = eps, epsMinus = eps;
+    epsPlus( j ) += h;
+    epsMinus( j ) -= h;
+    reference.col( j ) = ( localNewton( epsPlus, unused ) - localNewton( epsMinus, unused ) ) / ( 2 * h );
+  }
+
+  if ( ( tangent - reference ).norm() > 1e-7 * reference.norm() ) {
+    std::cout << "Implicit function tangent\n" << tangent << "\ndoes not match the finite difference tangent\n"
+              << reference << std::endl;
+    return 1;
+  }
+
+  const residual_function_type_dual residualDynamic = [&]( const autodiff::VectorXdual& X_,
+                                                           const autodiff::VectorXdual& eps_ ) {
+    return autodiff::VectorXdual( residual( X_, eps_ ) );
+  };
+  const Eigen::MatrixXd J              = dR_dXAt( X, eps );
+  const Eigen::MatrixXd tangentDynamic = implicitFunctionTangent( J.partialPivLu(), residualDynamic, X, eps );
+
+  if ( ( tangentDynamic - reference ).norm() > 1e-7 * reference.norm() ) {
+    std::cout << "Dynamic size implicit function tangent\n" << tangentDynamic << "\ndoes not match\n" << reference
+              << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include "Marmot/MarmotImplicitIntegration.h"
+#include <cmath>
+#include <iostream>
+
+using namespace Marmot::Math;
+
+int main()
+{
+  // stiff linear test problem y0' = -lambda ( y0 - y1 ), y1' = -y1; explicit Euler would require more than 2 lambda
+  // steps over the unit interval
+  const double lambda = 1e4;
+  auto         fRate  = [lambda]( const auto& y ) {
+    using Scalar = typename std::decay_t< decltype( y ) >::Scalar;
+    Eigen::Matrix< Scalar, 2, 1 > rate;
+    rate( 0 ) = -lambda * ( y( 0 ) - y( 1 ) );
+    rate( 1 ) = -y( 1 );
+    return rate;
+  };
+
+  const Eigen::Vector2d y0( 0, 1 );
+  const double          c       = lambda / ( lambda - 1 );
+  const Eigen::Vector2d yExact( c * std::exp( -1. ) - c * std::exp( -lambda ), std::exp( -1. ) );
+
+  const std::tuple< ImplicitScheme, const char*, double, int > cases[] = {
+    { ImplicitScheme::backwardEuler, "backward Euler", 1e-2, 1000 },
+    { ImplicitScheme::BDF2, "BDF2", 1e-3, 500 },
+    { ImplicitScheme::RadauIIA, "Radau IIA", 1e-6, 50 },
+  };
+
+  for ( const auto& [scheme, name, maxError, maxSteps] : cases ) {
+    ImplicitIntegrationOptions options;
+    options.relativeTolerance = 1e-4;
+    options.absoluteTolerance = 1e-4;
+    options.initialStep       = 1e-4;
+
+    const auto result = integrateImplicit( scheme, y0, 1., options, fRate );
+
+    if ( !result.converged || ( result.y - yExact ).lpNorm< Eigen::Infinity >() > maxError ||
+         result.acceptedSteps > maxSteps ) {
+      std::cout << name << " failed: y = " << result.y.transpose() << " != " << yExact.transpose() << " after "
+                << result.acceptedSteps << " steps" << std::endl;
+      return 1;
+    }
+
+    // linear problem: a single Jacobian, factorizations only on step size changes
+    if ( result.jacobianEvaluations != 1 ) {
+      std::cout << name << " evaluated the Jacobian " << result.jacobianEvaluations << " times" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
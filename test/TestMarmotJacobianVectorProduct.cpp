@@ -0,0 +1,120 @@
+#include "Marmot/MarmotAutomaticDifferentiation.h"
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include <iostream>
+#include <type_traits>
+
+using namespace Marmot;
+using namespace Marmot::NumericalAlgorithms;
+
+namespace {
+
+  const auto residual = []( const auto& X ) {
+    using std::exp;
+    using Scalar = typename std::decay_t< decltype( X ) >::Scalar;
+    Eigen::Matrix< Scalar, 3, 1 > R;
+    R( 0 ) = X( 0 ) * X( 1 ) + exp( 0.5 * X( 2 ) );
+    R( 1 ) = X( 1 ) * X( 1 ) * X( 2 ) - 2. * X( 0 );
+    R( 2 ) = X( 0 ) * X( 0 ) * X( 0 ) + X( 1 ) * X( 2 );
+    return R;
+  };
+
+  Eigen::Matrix3d analyticJacobian( const Eigen::Vector3d& X )
+  {
+    Eigen::Matrix3d J;
+    // clang-format off
+    J << X( 1 ),                X( 0 ),               0.5 * std::exp( 0.5 * X( 2 ) ),
+         -2.,                   2. * X( 1 ) * X( 2 ), X( 1 ) * X( 1 ),
+         3. * X( 0 ) * X( 0 ),  X( 2 ),               X( 1 );
+    // clang-format on
+    return J;
+  }
+
+  bool check( const std::string& name, const Eigen::VectorXd& Jv, const Eigen::VectorXd& reference, double tolerance )
+  {
+    if ( ( Jv - reference ).norm() > tolerance * reference.norm() ) {
+      std::cout << name << ": J v = " << Jv.transpose() << " differs from " << reference.transpose() << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+} // namespace
+
+int main()
+{
+  const Eigen::Vector3d X( 0.7, -1.2, 0.4 );
+  const Eigen::Vector3d v( 2., 0.5, -1. );
+  const Eigen::Vector3d reference = analyticJacobian( X ) * v;
+  const Eigen::Vector3d FX        = residual( X );
+
+  const Differentiation::vector_to_vector_function_type F = []( const Eigen::VectorXd& X_ ) -> Eigen::VectorXd {
+    return residual( Eigen::Vector3d( X_ ) );
+  };
+  const Differentiation::Complex::vector_to_vector_function_type FComplex =
+    []( const Eigen::VectorXcd& X_ ) -> Eigen::VectorXcd { return residual( Eigen::Vector3cd( X_ ) ); };
+  const AutomaticDifferentiation::vector_to_vector_function_type_dual FDual =
+    []( const autodiff::VectorXdual& X_ ) -> autodiff::VectorXdual {
+    return residual( Eigen::Matrix< autodiff::dual, 3, 1 >( X_ ) );
+  };
+
+  // dynamic size versions; fixed size arguments would select the fixed size templates
+  const Eigen::VectorXd XDynamic  = X;
+  const Eigen::VectorXd vDynamic  = v;
+  const Eigen::VectorXd FXDynamic = FX;
+
+  static_assert( std::is_same_v< decltype( Differentiation::forwardDifferenceJvp( F, XDynamic, vDynamic ) ),
+                                 Eigen::VectorXd > );
+  static_assert( std::is_same_v< decltype( Differentiation::forwardDifferenceJvp( F, XDynamic, FXDynamic, vDynamic ) ),
+                                 Eigen::VectorXd > );
+  static_assert( std::is_same_v< decltype( Differentiation::centralDifferenceJvp( F, XDynamic, vDynamic ) ),
+                                 Eigen::VectorXd > );
+
+  const auto [FXComplex, JvComplex] = Differentiation::Complex::forwardDifferenceJvp( FComplex, XDynamic, vDynamic );
+  const auto [FXDual, JvDual]       = AutomaticDifferentiation::jvp( FDual, XDynamic, vDynamic );
+
+  bool passed = true;
+
+  passed &= check( "forward difference",
+                   Differentiation::forwardDifferenceJvp( F, XDynamic, vDynamic ),
+                   reference,
+                   1e-6 );
+  passed &= check( "forward difference, given F( X )",
+                   Differentiation::forwardDifferenceJvp( F, XDynamic, FXDynamic, vDynamic ),
+                   reference,
+                   1e-6 );
+  passed &= check( "central difference",
+                   Differentiation::centralDifferenceJvp( F, XDynamic, vDynamic ),
+                   reference,
+                   1e-9 );
+  passed &= check( "complex step", JvComplex, reference, 1e-14 );
+  passed &= check( "complex step value", FXComplex, FX, 1e-14 );
+  passed &= check( "dual", JvDual, reference, 1e-14 );
+  passed &= check( "dual value", FXDual, FX, 1e-14 );
+
+  // fixed size versions
+  const auto [FXFixedDual, JvFixedDual]       = AutomaticDifferentiation::jvp< 3 >( residual, X, v );
+  const auto [FXFixedComplex, JvFixedComplex] = Differentiation::Complex::forwardDifferenceJvp( residual, X, v );
+
+  passed &= check( "fixed forward difference",
+                   Differentiation::forwardDifferenceJvp( residual, X, v ),
+                   reference,
+                   1e-6 );
+  passed &= check( "fixed forward difference, given F( X )",
+                   Differentiation::forwardDifferenceJvp( residual, X, FX, v ),
+                   reference,
+                   1e-6 );
+  passed &= check( "fixed central difference",
+                   Differentiation::centralDifferenceJvp( residual, X, v ),
+                   reference,
+                   1e-9 );
+  passed &= check( "fixed complex step", JvFixedComplex, reference, 1e-14 );
+  passed &= check( "fixed complex step value", FXFixedComplex, FX, 1e-14 );
+  passed &= check( "fixed dual", JvFixedDual, reference, 1e-14 );
+  passed &= check( "fixed dual value", FXFixedDual, FX, 1e-14 );
+
+  // a zero direction yields a zero product
+  const Eigen::VectorXd zero = Eigen::VectorXd::Zero( 3 );
+  passed &= Differentiation::centralDifferenceJvp( F, XDynamic, zero ).isZero();
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+#include "Marmot/MarmotBatch.h"
+#include "Marmot/MarmotMath.h"
+#include "autodiff/forward/dual/eigen.hpp"
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace Marmot;
+
+namespace {
+
+  bool check( const std::string& name, bool condition )
+  {
+    if ( !condition )
+      std::cout << name << " failed" << std::endl;
+    return condition;
+  }
+
+  bool testIntegrators()
+  {
+    const Eigen::Vector2d y( 1., 2. );
+    const auto            fRate = []( const Eigen::Vector2d& x ) -> Eigen::Vector2d { return -x; };
+
+    bool passed = true;
+
+    // the time step and tolerance do not take part in the deduction of the scalar type, and the state may be an
+    // expression, so that integer or float arguments and sums are accepted as for double only kernels
+    const Eigen::Vector2d reference = Math::semiImplicitEuler< 2 >( y, 1., fRate );
+    passed &= check( "semiImplicitEuler, int time step", Math::semiImplicitEuler< 2 >( y, 1, fRate ) == reference );
+    const Eigen::Vector2d yEuler = Math::semiImplicitEuler< 2 >( y, 0.1, fRate );
+    passed &= check( "semiImplicitEuler, expression",
+                     Math::semiImplicitEuler< 2 >( y + y, 0.1, fRate ).isApprox( 2 * yEuler ) );
+
+    const auto [yNew, dtNew]       = Math::explicitEulerRichardsonWithErrorEstimator< 2 >( y, 0.1, 1e-3f, fRate );
+    const auto [yNewSum, dtNewSum] = Math::explicitEulerRichardsonWithErrorEstimator< 2 >( y + y, 0.1, 1e-3, fRate );
+    passed &= check( "explicitEulerRichardsonWithErrorEstimator", yNew.isApprox( y * ( 1 - 0.1 + 0.005 ) ) );
+    passed &= check( "explicitEulerRichardsonWithErrorEstimator, expression",
+                     yNewSum.isApprox( 2 * yNew ) && dtNew > 0 && dtNewSum > 0 );
+
+    passed &= check( "centralDiff, expression",
+                     Math::centralDiff< 2, 2 >( fRate, y + y ).isApprox( -Eigen::Matrix2d::Identity(), 1e-8 ) );
+
+    // scalar types besides double are deduced from the state
+    const Eigen::Vector2f yFloat( 1.f, 2.f );
+    const auto            fRateFloat = []( const Eigen::Vector2f& x ) -> Eigen::Vector2f { return -x; };
+    const Eigen::Vector2f yFloatNew  = Math::semiImplicitEuler< 2 >( yFloat, 0.1, fRateFloat );
+    passed &= check( "semiImplicitEuler, float", yFloatNew.isApprox( yFloat / 1.1f, 1e-5f ) );
+
+    return passed;
+  }
+
+  bool testMakeReal()
+  {
+    bool passed = true;
+
+    passed &= check( "makeReal, complex", Math::makeReal( std::complex< double >( 2., 3. ) ) == 2. );
+    autodiff::dual x = 4.;
+    autodiff::seed< 1 >( x, 1. );
+    passed &= check( "makeReal, dual", Math::makeReal( x ) == 4. );
+
+    Eigen::Matrix< std::complex< double >, 2, 3 > C;
+    C << std::complex< double >( 1, 1 ), 2, 3, 4, std::complex< double >( 5, -1 ), 6;
+    Eigen::Matrix< double, 2, 3 > reference;
+    reference << 1, 2, 3, 4, 5, 6;
+
+    // the matrix version returns a matrix, not an expression referring to its argument
+    static_assert( std::is_same_v< decltype( Math::makeReal( C ) ), Eigen::Matrix< double, 2, 3 > > );
+    static_assert( std::is_same_v< decltype( Math::makeReal( Eigen::VectorXcd() ) ), Eigen::VectorXd > );
+    const auto fromTemporary = Math::makeReal( Eigen::Matrix< std::complex< double >, 2, 3 >( C ) );
+    passed &= check( "makeReal, complex matrix", fromTemporary == reference );
+    passed &= check( "makeReal, block", Math::makeReal( C.block< 2, 2 >( 0, 1 ) ) == reference.block< 2, 2 >( 0, 1 ) );
+
+    autodiff::VectorXdual D = reference.col( 2 ).cast< autodiff::dual >();
+    passed &= check( "makeReal, dual vector", Math::makeReal( D ) == reference.col( 2 ) );
+
+    Eigen::Matrix< double, 2, 3 > out = Eigen::Matrix< double, 2, 3 >::Zero();
+    Math::makeReal( C, out );
+    passed &= check( "makeReal, output argument", out == reference );
+
+    Eigen::Matrix4d large = Eigen::Matrix4d::Zero();
+    auto            block = large.block< 2, 3 >( 1, 1 );
+    Math::makeReal( C, block );
+    passed &= check( "makeReal, output block", large.block< 2, 3 >( 1, 1 ) == reference && large.col( 0 ).isZero() );
+
+    passed &= check( "realView", Eigen::Matrix< double, 2, 3 >( Math::realView( C ) ) == reference );
+
+    return passed;
+  }
+
+  /**
+   * Identical results, both NaN, or, for transcendental functions, equal up to \ref ulps units in the last place */
+  bool sameValue( double a, double b, double ulps = 0 )
+  {
+    if ( Math::isNaN( a ) || Math::isNaN( b ) )
+      return Math::isNaN( a ) && Math::isNaN( b );
+    return a == b || std::abs( a - b ) <= ulps * std::numeric_limits< double >::epsilon() * std::abs( b );
+  }
+
+  bool testElementwise()
+  {
+    const double nan = std::numeric_limits< double >::quiet_NaN();
+    const double lower = -64.;
+    const double upper = 64.;
+
+    // 15 values, distributed over 5 lanes of 3 coefficients
+    const std::vector< double > values = { -1000.,
+                                           std::nextafter( lower, -1000. ),
+                                           lower,
+                                           std::nextafter( lower, 0. ),
+                                           -1.5,
+                                           -0.,
+                                           0.,
+                                           0.5,
+                                           63.5,
+                                           std::nextafter( upper, 0. ),
+                                           upper,
+                                           std::nextafter( upper, 1000. ),
+                                           1000.,
+                                           nan,
+                                           -nan };
+    const int nValues = static_cast< int >( values.size() );
+
+    Eigen::ArrayXd x( nValues );
+    for ( int i = 0; i < nValues; i++ )
+      x( i ) = values[i];
+
+    // the same values distributed over the lanes and coefficients of a batch
+    Batch< Vector3d, Eigen::Dynamic > b( nValues / 3 );
+    for ( int i = 0; i < nValues; i++ )
+      b.data( i % b.lanes(), i / b.lanes() ) = values[i];
+
+    const Eigen::ArrayXd expX       = Math::exp( x );
+    const Eigen::ArrayXd macaulyX   = Math::macauly( x );
+    const Eigen::ArrayXd heavisideX = Math::heaviside( x );
+    const Eigen::ArrayXd sgnX       = Math::sgn( x );
+
+    const auto expB       = Math::exp( b );
+    const auto macaulyB   = Math::macauly( b );
+    const auto heavisideB = Math::heaviside( b );
+    const auto sgnB       = Math::sgn( b );
+
+    bool passed = true;
+    for ( int i = 0; i < nValues; i++ ) {
+      const double xi = values[i];
+      const int    k  = i % b.lanes();
+      const int    j  = i / b.lanes();
+
+      // the vectorized exp of Eigen may differ from std::exp in the last bits
+      const double expected = Math::exp( xi );
+      passed &= check( "exp, array at " + std::to_string( xi ), sameValue( expX( i ), expected, 4 ) );
+      passed &= check( "exp, batch at " + std::to_string( xi ), sameValue( expB.data( k, j ), expected, 4 ) );
+
+      passed &= check( "macauly, array at " + std::to_string( xi ), sameValue( macaulyX( i ), Math::macauly( xi ) ) );
+      passed &= check( "macauly, batch at " + std::to_string( xi ),
+                       sameValue( macaulyB.data( k, j ), Math::macauly( xi ) ) );
+
+      passed &= check( "heaviside, array at " + std::to_string( xi ),
+                       sameValue( heavisideX( i ), Math::heaviside( xi ) ) );
+      passed &= check( "heaviside, batch at " + std::to_string( xi ),
+                       sameValue( heavisideB.data( k, j ), Math::heaviside( xi ) ) );
+
+      passed &= check( "sgn, array at " + std::to_string( xi ), sameValue( sgnX( i ), Math::sgn( xi ) ) );
+      passed &= check( "sgn, batch at " + std::to_string( xi ), sameValue( sgnB.data( k, j ), Math::sgn( xi ) ) );
+    }
+
+    // the limits of the scalar exp
+    passed &= check( "exp, lower limit", Math::exp( -64. ) == 0. && Math::exp( -1000. ) == 0. );
+    passed &= check( "exp, upper limit", Math::exp( 1000. ) == std::exp( 64. ) && Math::exp( 64. ) == std::exp( 64. ) );
+    passed &= check( "exp, NaN", Math::isNaN( Math::exp( nan ) ) );
+
+    return passed;
+  }
+
+} // namespace
+
+int main()
+{
+  bool passed = true;
+  passed &= testIntegrators();
+  passed &= testMakeReal();
+  passed &= testElementwise();
+  return passed ? 0 : 1;
+}
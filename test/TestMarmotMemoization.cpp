@@ -0,0 +1,56 @@
+#include "Marmot/MarmotMemoization.h"
+#include "Marmot/MarmotNumericalDifferentiation.h"
+#include "Marmot/MarmotNumericalIntegration.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::NumericalAlgorithms;
+
+int main()
+{
+  int        nEvaluations = 0;
+  const auto residual     = [&]( const Eigen::VectorXd& X ) -> Eigen::VectorXd {
+    nEvaluations++;
+    return X.array().sin() * X.sum();
+  };
+
+  const Eigen::VectorXd X = Eigen::VectorXd::LinSpaced( 6, 0.1, 0.6 );
+
+  // more perturbed points than entries: the base point is protected after the first hit
+  MemoizedFunction< Eigen::VectorXd, Eigen::VectorXd > F( residual, 4 );
+
+  const Eigen::VectorXd R  = F( X );
+  const Eigen::MatrixXd J  = Differentiation::forwardDifference( F, X );
+  const Eigen::MatrixXd J_ = Differentiation::centralDifference( F, X );
+
+  if ( nEvaluations != 1 + 6 + 12 || F.hits() != 1 ) {
+    std::cout << "Base point was evaluated again: " << nEvaluations << " evaluations, " << F.hits() << " hits"
+              << std::endl;
+    return 1;
+  }
+
+  if ( ( F( X ) - R ).norm() != 0 || F.hits() != 2 || nEvaluations != 19 ) {
+    std::cout << "Base point was not retained by the cache" << std::endl;
+    return 1;
+  }
+
+  if ( ( J - Differentiation::forwardDifference( residual, X ) ).norm() != 0 ) {
+    std::cout << "Memoized forward difference differs from the plain one" << std::endl;
+    return 1;
+  }
+
+  // the trapezoidal rule evaluates each interior node twice
+  int                                nScalarEvaluations = 0;
+  MemoizedFunction< double, double > f( [&]( double x ) {
+    nScalarEvaluations++;
+    return x * x;
+  } );
+  const double integral = Integration::integrateScalarFunction( f, { 0., 1. }, 10, Integration::trapezodial );
+
+  if ( nScalarEvaluations != 11 || std::abs( integral - 1. / 3 ) > 1e-2 ) {
+    std::cout << "Memoized trapezoidal rule used " << nScalarEvaluations << " evaluations" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
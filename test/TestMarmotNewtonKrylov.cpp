@@ -0,0 +1,98 @@
+#include "Marmot/MarmotNewtonKrylov.h"
+#include <iostream>
+
+using namespace Marmot::NumericalAlgorithms;
+
+namespace {
+
+  const int    n = 200;
+  const double l = 4.; // squared internal length over the squared grid spacing
+
+  // discrete gradient-enhanced local system: X - l Laplace( X ) + 0.1 X^3 = f
+  template < typename Vector >
+  Vector residual( const Vector& X )
+  {
+    Vector R( X.size() );
+    for ( Eigen::Index i = 0; i < X.size(); i++ ) {
+      const auto left  = i > 0 ? X( i - 1 ) : X( i );
+      const auto right = i < X.size() - 1 ? X( i + 1 ) : X( i );
+      R( i ) = X( i ) - l * ( left - 2. * X( i ) + right ) + 0.1 * X( i ) * X( i ) * X( i ) - std::sin( 0.05 * i );
+    }
+    return R;
+  }
+
+  bool checkSolution( const std::string& name, const NewtonKrylov::NewtonKrylovResult& result )
+  {
+    const double residualNorm = residual( result.X ).norm();
+    if ( !result.converged || residualNorm > 1e-10 ) {
+      std::cout << name << " failed to converge, |R| = " << residualNorm << std::endl;
+      return false;
+    }
+    if ( result.krylovIterations >= result.newtonIterations * n ) {
+      std::cout << name << " required " << result.krylovIterations << " Krylov iterations" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+} // namespace
+
+int main()
+{
+  bool passed = true;
+
+  // GMRES for a nonsymmetric dense system, with and without restarts
+  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity( 40, 40 ) * 4. + Eigen::MatrixXd::Random( 40, 40 ) * 0.3;
+  const Eigen::VectorXd b = Eigen::VectorXd::LinSpaced( 40, -1., 2. );
+  const Eigen::VectorXd x = A.partialPivLu().solve( b );
+
+  for ( const int restart : { 40, 5 } ) {
+    NewtonKrylov::GMRESOptions options;
+    options.relativeTolerance = 1e-12;
+    options.restart           = restart;
+
+    Eigen::VectorXd xGMRES = Eigen::VectorXd::Zero( 40 );
+    const auto result = NewtonKrylov::gmres( [&]( const Eigen::VectorXd& v ) -> Eigen::VectorXd { return A * v; },
+                                             b,
+                                             xGMRES,
+                                             options );
+    if ( !result.converged || ( xGMRES - x ).norm() > 1e-10 * x.norm() ) {
+      std::cout << "gmres with restart " << restart << " failed" << std::endl;
+      passed = false;
+    }
+  }
+
+  // Jacobian-free Newton-Krylov for the gradient-enhanced system
+  const NewtonConvergenceChecker checker( Eigen::VectorXd::Ones( n ), 15, 20, 1e-11, 1e-10, 1e-9, 1e-8 );
+  const Eigen::VectorXd          X0 = Eigen::VectorXd::Zero( n );
+
+  NewtonKrylov::GMRESOptions options;
+  options.relativeTolerance = 1e-6;
+
+  // inverse diagonal of the linear part of the Jacobian
+  const NewtonKrylov::preconditioner_type jacobi = []( const Eigen::VectorXd& r ) -> Eigen::VectorXd {
+    return r / ( 1. + 2. * l );
+  };
+
+  const auto dual = NewtonKrylov::solve(
+    []( const autodiff::VectorXdual& X ) -> autodiff::VectorXdual { return residual( X ); },
+    X0,
+    checker,
+    options );
+  const auto complexStep = NewtonKrylov::solveComplexStep(
+    []( const Eigen::VectorXcd& X ) -> Eigen::VectorXcd { return residual( X ); },
+    X0,
+    checker,
+    options,
+    jacobi );
+
+  passed &= checkSolution( "dual", dual );
+  passed &= checkSolution( "complex step", complexStep );
+
+  if ( ( dual.X - complexStep.X ).norm() > 1e-10 * dual.X.norm() ) {
+    std::cout << "dual and complex step solutions differ" << std::endl;
+    passed = false;
+  }
+
+  return passed ? 0 : 1;
+}
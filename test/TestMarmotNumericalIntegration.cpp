@@ -17,5 +17,25 @@ int main()
     return 1;
   }
 
+  // Test Simpson Rule with a nonzero lower limit
+  res = integrateScalarFunction( f, { 1., 2. }, 1, integrationRule::simpson );
+
+  if ( res != 3.75 ) {
+    std::cout << "Numerical Integration with Simpson Rule failed: " << res << " != 3.75" << std::endl;
+    return 1;
+  }
+
+  // Test Simpson Rule in single precision
+  const float resFloat = integrateScalarFunction< float >( []( float x ) { return x * x * x; },
+                                                           { 0.f, 1.f },
+                                                           1,
+                                                           integrationRule::simpson );
+
+  if ( resFloat != 0.25f ) {
+    std::cout << "Numerical Integration with Simpson Rule in single precision failed: " << resFloat << " != 0.25"
+              << std::endl;
+    return 1;
+  }
+
   return 0;
 }
@@ -0,0 +1,120 @@
+#include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotOrientationTable.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::Math;
+
+namespace {
+
+  bool check( const std::string& name, const Eigen::MatrixXd& value, const Eigen::MatrixXd& reference )
+  {
+    if ( ( value - reference ).norm() > 1e-12 * std::max( 1., reference.norm() ) ) {
+      std::cout << name << " failed:\n" << value << "\n!=\n" << reference << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * Direction cosines as computed originally, i.e., by projecting onto a global coordinate system constructed from
+   * the \f$ x_1 \f$ - axis */
+  Matrix3d directionCosinesReference( const Matrix3d& transformedCoordinateSystem )
+  {
+    Vector3d unitVectorX1;
+    unitVectorX1 << 1, 0, 0;
+
+    const Matrix3d globalCoordinateSystem = orthonormalCoordinateSystem( unitVectorX1 );
+    Matrix3d       directionCos;
+
+    for ( int i = 0; i <= 2; i++ )
+      for ( int j = 0; j <= 2; j++ )
+        directionCos( i, j ) = transformedCoordinateSystem.col( i ).dot( globalCoordinateSystem.col( j ) );
+
+    return directionCos;
+  }
+
+  // Voigt notation ( 11, 22, 33, 12, 13, 23 ), with the shear components scaled by shearFactor in Voigt notation
+  Matrix3d toTensor( const Vector6d& voigt, double shearFactor )
+  {
+    Matrix3d tensor;
+    // clang-format off
+    tensor << voigt( 0 ),               voigt( 3 ) / shearFactor, voigt( 4 ) / shearFactor,
+              voigt( 3 ) / shearFactor, voigt( 1 ),               voigt( 5 ) / shearFactor,
+              voigt( 4 ) / shearFactor, voigt( 5 ) / shearFactor, voigt( 2 );
+    // clang-format on
+    return tensor;
+  }
+
+  Vector6d toVoigt( const Matrix3d& tensor, double shearFactor )
+  {
+    Vector6d voigt;
+    voigt << tensor( 0, 0 ), tensor( 1, 1 ), tensor( 2, 2 ), shearFactor * tensor( 0, 1 ),
+      shearFactor * tensor( 0, 2 ), shearFactor * tensor( 1, 2 );
+    return voigt;
+  }
+
+} // namespace
+
+int main()
+{
+  bool passed = true;
+
+  Eigen::Matrix< double, 3, Eigen::Dynamic > normals( 3, 4 );
+  normals.col( 0 ) = Vector3d( 1, 2, 3 ).normalized();
+  normals.col( 1 ) = Vector3d( -0.3, 0.1, 0.9 ).normalized();
+  normals.col( 2 ) = Vector3d( 0, 0, 1 );
+  normals.col( 3 ) = Vector3d( 1, 0, 0 );
+
+  const OrientationTable table = OrientationTable::fromNormals( normals );
+  passed &= table.size() == 4;
+
+  Vector6d stress;
+  stress << 10, -5, 3, 2, -1, 4;
+  Vector6d strain;
+  strain << 1e-3, -2e-3, 5e-4, 3e-4, -1e-4, 2e-4;
+
+  const OrientationTable::Matrix6Xd localStresses = table.rotateStressIn( stress );
+  const OrientationTable::Matrix6Xd localStrains  = table.rotateStrainIn( strain );
+
+  for ( int i = 0; i < table.size(); i++ ) {
+    const Matrix3d& axes = table.coordinateSystem( i );
+    const Matrix3d& Q    = table.directionCosines( i );
+    const Matrix6d  Ts   = table.stressTransformation( i );
+    const Matrix6d  Te   = table.strainTransformation( i );
+
+    passed &= check( "local x1 - axis", axes.col( 0 ), normals.col( i ) );
+    passed &= check( "orthonormal axes", axes.transpose() * axes, Matrix3d::Identity() );
+
+    // the shortcut matches the original direction cosines and the free function
+    passed &= check( "directionCosines", Q, directionCosinesReference( axes ) );
+    passed &= check( "Math::directionCosines", Math::directionCosines( axes ), directionCosinesReference( axes ) );
+
+    // Voigt operators match the rotation of the full tensors sigma' = Q sigma Q^T
+    const Vector6d rotatedStress = toVoigt( Q * toTensor( stress, 1. ) * Q.transpose(), 1. );
+    const Vector6d rotatedStrain = toVoigt( Q * toTensor( strain, 2. ) * Q.transpose(), 2. );
+    passed &= check( "stress transformation", Ts * stress, rotatedStress );
+    passed &= check( "strain transformation", Te * strain, rotatedStrain );
+    passed &= check( "voigtStressTransformation", voigtStressTransformation( Q ), Ts );
+    passed &= check( "voigtStrainTransformation", voigtStrainTransformation( Q ), Te );
+    passed &= check( "rotateStressIn", localStresses.col( i ), rotatedStress );
+    passed &= check( "rotateStrainIn", localStrains.col( i ), rotatedStrain );
+
+    // inverse relations T_epsilon = T_sigma^-T, and the inverse rotation by Q^T
+    passed &= check( "T_sigma^-1 = T_epsilon^T", Ts.inverse(), Te.transpose() );
+    passed &= check( "T_sigma( Q^T ) = T_sigma^-1", voigtStressTransformation( Q.transpose() ), Ts.inverse() );
+    passed &= check( "T_epsilon( Q^T ) = T_epsilon^-1", voigtStrainTransformation( Q.transpose() ), Te.inverse() );
+
+    // the stress power is invariant
+    passed &= check( "stress power",
+                     Eigen::Matrix< double, 1, 1 >( rotatedStress.dot( rotatedStrain ) ),
+                     Eigen::Matrix< double, 1, 1 >( stress.dot( strain ) ) );
+  }
+
+  // rotating in and out with the weights summing up to 1 recovers the global quantities
+  const Eigen::VectorXd weights = Eigen::VectorXd::Constant( table.size(), 1. / table.size() );
+  passed &= check( "rotateStressOut", table.rotateStressOut( localStresses, weights ), stress );
+  passed &= check( "rotateStrainOut", table.rotateStrainOut( localStrains, weights ), strain );
+
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,51 @@
+#include "Marmot/MarmotMath.h"
+#include "Marmot/MarmotNumericalIntegration.h"
+#include "Marmot/MarmotProfiling.h"
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace Marmot;
+
+int main()
+{
+  Profiling::enableTrace( 64 );
+
+  auto integrate = []() {
+    Vector3d y( 1., 2., 3. );
+    for ( int i = 0; i < 10; i++ )
+      y = Math::explicitEuler( y, 0.1, []( const Vector3d& x ) -> Vector3d { return -x; } );
+
+    NumericalAlgorithms::Integration::integrateScalarFunction( []( double x ) { return x * x; },
+                                                               { 0., 1. },
+                                                               10,
+                                                               NumericalAlgorithms::Integration::simpson );
+  };
+
+  std::thread first( integrate ), second( integrate );
+  first.join();
+  second.join();
+
+  std::ostringstream json;
+  Profiling::writeJSON( json );
+
+  // counters of both threads are aggregated
+  const std::string expected[] = {
+    "{\"name\": \"Math::explicitEuler\", \"calls\": 20, \"functionEvaluations\": 20",
+    "{\"name\": \"Integration::integrateScalarFunction\", \"calls\": 2, \"functionEvaluations\": 60",
+  };
+  for ( const auto& entry : expected )
+    if ( json.str().find( entry ) == std::string::npos ) {
+      std::cout << "Profiling counters failed: " << std::endl << json.str() << std::endl;
+      return 1;
+    }
+
+  std::ostringstream trace;
+  Profiling::writeChromeTrace( trace );
+  if ( trace.str().find( "\"ph\": \"X\", \"pid\": 0, \"tid\": 1" ) == std::string::npos ) {
+    std::cout << "Profiling trace failed: " << std::endl << trace.str() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
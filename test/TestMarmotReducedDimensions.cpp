@@ -0,0 +1,76 @@
+#include "Marmot/MarmotReducedVoigt.h"
+#include "Marmot/MarmotTensor.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::ContinuumMechanics;
+using namespace Marmot::ContinuumMechanics::ReducedVoigt;
+
+namespace {
+
+  template < typename TensorA, typename TensorB >
+  double difference( const TensorA& a, const TensorB& b )
+  {
+    const Eigen::Tensor< double, 0 > norm = ( a - b ).abs().maximum();
+    return norm();
+  }
+
+  double J2( const Vector6d& stress )
+  {
+    const Vector6d s = stress - stress.head< 3 >().mean() * ( Vector6d() << 1, 1, 1, 0, 0, 0 ).finished();
+    return 0.5 * s.head< 3 >().squaredNorm() + s.tail< 3 >().squaredNorm();
+  }
+
+} // namespace
+
+int main()
+{
+  // the 3D instantiation reproduces the global tensors
+  using Tensors3D = CommonTensors::OfDimension< 3 >;
+  if ( difference( Tensors3D::Isym, CommonTensors::Isym ) > 0 ||
+       difference( Tensors3D::Iskew, CommonTensors::Iskew ) > 0 ||
+       difference( Tensors3D::I2xI2, CommonTensors::I2xI2 ) > 0 ||
+       difference( Tensors3D::dDeviatoricStress_dStress, CommonTensors::dDeviatoricStress_dStress ) > 1e-16 ) {
+    std::cout << "OfDimension< 3 > differs from the global tensors" << std::endl;
+    return 1;
+  }
+
+  // native 2D: the deviatoric projector of a 2x2 tensor
+  using IndexPair = Eigen::IndexPair< int >;
+  const Eigen::Matrix2d                                      A  = Eigen::Matrix2d::Random();
+  const Eigen::TensorMap< const Eigen::Tensor< double, 2 > > A_( A.data(), 2, 2 );
+  const Eigen::array< IndexPair, 2 >                         kl = { IndexPair( 2, 0 ), IndexPair( 3, 1 ) };
+
+  const Eigen::Matrix2d devARef = A - 0.5 * A.trace() * Eigen::Matrix2d::Identity();
+
+  const Eigen::Tensor< double, 2 > devA = CommonTensors::OfDimension< 2 >::dDeviatoricStress_dStress.contract( A_, kl );
+  for ( int i = 0; i < 2; i++ )
+    for ( int j = 0; j < 2; j++ )
+      if ( std::abs( devA( i, j ) - devARef( i, j ) ) > 1e-15 ) {
+        std::cout << "OfDimension< 2 > deviatoric projector failed" << std::endl;
+        return 1;
+      }
+
+  // plane strain: the four component kernels match the 3D ones with vanishing 13 and 23 components
+  constexpr auto planeStrain = ReducedState::planeStrain;
+  const Vector4d stress( 3., -1., 0.5, 2. );
+  const Vector6d stress3D = expand< planeStrain >( stress );
+  if ( std::abs( ReducedVoigt::J2< planeStrain >( stress ) - J2( stress3D ) ) > 1e-14 ||
+       std::abs( trace< ReducedState::axisymmetric >( stress ) - 2.5 ) > 1e-15 ||
+       ( reduce< planeStrain >( stress3D ) - stress ).norm() != 0 ||
+       ( deviatoricProjector< planeStrain >() * stress - deviatoric< planeStrain >( stress ) ).norm() > 1e-15 ) {
+    std::cout << "Plane strain kernels failed" << std::endl;
+    return 1;
+  }
+
+  // two dimensional: the three component deviator matches the 2x2 tensor deviator
+  const Eigen::Vector3d stress2D( A( 0, 0 ), A( 1, 1 ), 0.5 * ( A( 0, 1 ) + A( 1, 0 ) ) );
+  const Eigen::Vector3d dev2D = deviatoric< ReducedState::twoDimensional >( stress2D );
+  if ( std::abs( dev2D( 0 ) - devARef( 0, 0 ) ) > 1e-15 || std::abs( dev2D( 1 ) - devARef( 1, 1 ) ) > 1e-15 ||
+       expand< ReducedState::twoDimensional >( stress2D )( 3 ) != stress2D( 2 ) ) {
+    std::cout << "Two dimensional kernels failed" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include "Marmot/MarmotStressInvariants.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::ContinuumMechanics::StressInvariants;
+
+namespace {
+
+  using VoigtInvariant = InvariantWithDerivatives< double, Vector6d, Matrix6d >;
+
+  const VoigtInvariant& select( const VoigtStressInvariants< double >& inv, int which )
+  {
+    const VoigtInvariant* all[] = { &inv.I1, &inv.J2, &inv.J3, &inv.lodeAngle };
+    return *all[which];
+  }
+
+  bool checkAgainstFiniteDifferences( const Vector6d& stress )
+  {
+    const auto   inv = invariants( stress );
+    const double h   = 1e-5;
+
+    for ( int which = 0; which < 4; which++ ) {
+      Vector6d gradient;
+      Matrix6d hessian;
+      for ( int i = 0; i < 6; i++ ) {
+        Vector6d plus = stress, minus = stress;
+        plus( i ) += h;
+        minus( i ) -= h;
+        const auto invPlus  = invariants( plus );
+        const auto invMinus = invariants( minus );
+        gradient( i )       = ( select( invPlus, which ).value - select( invMinus, which ).value ) / ( 2 * h );
+        hessian.col( i )    = ( select( invPlus, which ).dStress - select( invMinus, which ).dStress ) / ( 2 * h );
+      }
+
+      const VoigtInvariant& I = select( inv, which );
+      if ( ( gradient - I.dStress ).norm() > 1e-7 * ( 1 + gradient.norm() ) ||
+           ( hessian - I.d2Stress ).norm() > 1e-7 * ( 1 + hessian.norm() ) ) {
+        std::cout << "Derivatives of invariant " << which << " do not match finite differences" << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool checkTensorForm( const Vector6d& stress )
+  {
+    const int voigtIndex[6][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+
+    Matrix3d S;
+    for ( int a = 0; a < 6; a++ )
+      S( voigtIndex[a][0], voigtIndex[a][1] ) = S( voigtIndex[a][1], voigtIndex[a][0] ) = stress( a );
+
+    const auto voigt  = invariants( stress );
+    const auto tensor = invariants( S );
+
+    const InvariantWithDerivatives< double, Matrix3d, EigenTensors::Tensor3333d >* all[] = { &tensor.I1,
+                                                                                             &tensor.J2,
+                                                                                             &tensor.J3,
+                                                                                             &tensor.lodeAngle };
+
+    // a Voigt shear component perturbs both symmetric tensor components
+    for ( int which = 0; which < 4; which++ ) {
+      const auto& T = *all[which];
+      Vector6d    gradient;
+      Matrix6d    hessian;
+      for ( int a = 0; a < 6; a++ ) {
+        const int i = voigtIndex[a][0], j = voigtIndex[a][1];
+        gradient( a ) = T.dStress( i, j ) + ( i != j ? T.dStress( j, i ) : 0 );
+        for ( int b = 0; b < 6; b++ ) {
+          const int k = voigtIndex[b][0], l = voigtIndex[b][1];
+          hessian( a, b ) = T.d2Stress( i, j, k, l );
+          if ( i != j )
+            hessian( a, b ) += T.d2Stress( j, i, k, l );
+          if ( k != l )
+            hessian( a, b ) += T.d2Stress( i, j, l, k );
+          if ( i != j && k != l )
+            hessian( a, b ) += T.d2Stress( j, i, l, k );
+        }
+      }
+
+      const VoigtInvariant& V = select( voigt, which );
+      if ( std::abs( T.value - V.value ) > 1e-12 * ( 1 + std::abs( V.value ) ) ||
+           ( gradient - V.dStress ).norm() > 1e-12 * ( 1 + V.dStress.norm() ) ||
+           ( hessian - V.d2Stress ).norm() > 1e-12 * ( 1 + V.d2Stress.norm() ) ) {
+        std::cout << "Tensor form of invariant " << which << " does not match the Voigt form" << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool checkBatch()
+  {
+    constexpr int        K = 8;
+    Batch< Vector6d, K > stress;
+    for ( int k = 0; k < K; k++ )
+      stress.set( k, Vector6d::Random() * ( k + 1 ) );
+    // a hydrostatic lane, for which J2 and the Lode angle derivatives vanish
+    stress.set( 0, ( Vector6d() << 1, 1, 1, 0, 0, 0 ).finished() );
+
+    const auto batch = invariants( stress );
+    for ( int k = 0; k < K; k++ ) {
+      const auto scalar = invariants( Vector6d( stress.get( k ) ) );
+      if ( std::abs( batch.lodeAngle.value( k ) - scalar.lodeAngle.value ) > 1e-14 ||
+           ( batch.lodeAngle.dStress.get( k ) - scalar.lodeAngle.dStress ).norm() > 1e-12 ||
+           ( batch.lodeAngle.d2Stress.get( k ) - scalar.lodeAngle.d2Stress ).norm() > 1e-12 ||
+           ( batch.J3.d2Stress.get( k ) - scalar.J3.d2Stress ).norm() > 1e-12 ) {
+        std::cout << "Batched invariants do not match lane " << k << std::endl;
+        return false;
+      }
+    }
+
+    if ( batch.lodeAngle.dStress.get( 0 ).norm() != 0 || batch.lodeAngle.d2Stress.get( 0 ).norm() != 0 ) {
+      std::cout << "Lode angle derivatives do not vanish for a hydrostatic stress" << std::endl;
+      return false;
+    }
+    return true;
+  }
+
+} // namespace
+
+int main()
+{
+  const Vector6d stress = ( Vector6d() << 10, -3, 4, 2, -1, 3 ).finished();
+
+  return checkAgainstFiniteDifferences( stress ) && checkTensorForm( stress ) && checkBatch() ? 0 : 1;
+}
@@ -0,0 +1,129 @@
+#include "Marmot/MarmotTabulatedFunction.h"
+#include <iostream>
+
+using namespace Marmot::Math;
+using Interpolation = TabulatedFunction::Interpolation;
+using Extrapolation = TabulatedFunction::Extrapolation;
+
+namespace {
+
+  bool checkDerivatives( const TabulatedFunction& curve, const char* name )
+  {
+    const Eigen::ArrayXd x = Eigen::ArrayXd::LinSpaced( 41, -0.5, 2.5 ) + 0.013;
+
+    const Eigen::ArrayXd values      = curve.evaluate( x );
+    const Eigen::ArrayXd derivatives = curve.evaluateDerivative( x );
+
+    for ( Eigen::Index k = 0; k < x.size(); k++ ) {
+      const double h           = 1e-6;
+      const double central     = ( curve( x( k ) + h ) - curve( x( k ) - h ) ) / ( 2 * h );
+      const double complexStep = curve( std::complex< double >( x( k ), 1e-20 ) ).imag() / 1e-20;
+
+      autodiff::dual xDual = x( k );
+      autodiff::seed< 1 >( xDual, 1.0 );
+      const autodiff::dual yDual = curve( xDual );
+
+      if ( values( k ) != curve( x( k ) ) || derivatives( k ) != curve.derivative( x( k ) ) ||
+           std::abs( central - derivatives( k ) ) > 1e-6 || std::abs( complexStep - derivatives( k ) ) > 1e-12 ||
+           std::abs( autodiff::derivative< 1 >( yDual ) - derivatives( k ) ) > 1e-12 ||
+           std::abs( yDual.val - values( k ) ) > 1e-14 ) {
+        std::cout << name << ": derivative mismatch at x = " << x( k ) << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * The derivative is generic in the scalar type as well: its real part is the derivative, and its complex step
+   * or dual derivative is the second derivative */
+  bool checkScalarTypesOfDerivative( const TabulatedFunction& curve, const char* name )
+  {
+    const Eigen::ArrayXd x = Eigen::ArrayXd::LinSpaced( 41, -0.5, 2.5 ) + 0.013;
+
+    Eigen::ArrayXcd xComplex = x.cast< std::complex< double > >();
+    xComplex.imag().setConstant( 1e-20 );
+
+    Eigen::Array< autodiff::dual, Eigen::Dynamic, 1 > xDual( x.size() );
+    for ( Eigen::Index k = 0; k < x.size(); k++ ) {
+      xDual( k ) = x( k );
+      autodiff::seed< 1 >( xDual( k ), 1.0 );
+    }
+
+    const Eigen::ArrayXd                                    derivatives        = curve.evaluateDerivative( x );
+    const Eigen::ArrayXcd                                   derivativesComplex = curve.evaluateDerivative( xComplex );
+    const Eigen::Array< autodiff::dual, Eigen::Dynamic, 1 > derivativesDual    = curve.evaluateDerivative( xDual );
+
+    for ( Eigen::Index k = 0; k < x.size(); k++ ) {
+      const double h                = 1e-6;
+      const double secondDerivative = ( curve.derivative( x( k ) + h ) - curve.derivative( x( k ) - h ) ) / ( 2 * h );
+
+      const std::complex< double > complexStep = curve.derivative( xComplex( k ) );
+      const autodiff::dual         dual        = curve.derivative( xDual( k ) );
+
+      if ( complexStep != derivativesComplex( k ) || dual.val != derivativesDual( k ).val ||
+           std::abs( complexStep.real() - derivatives( k ) ) > 1e-14 ||
+           std::abs( dual.val - derivatives( k ) ) > 1e-14 ||
+           std::abs( complexStep.imag() / 1e-20 - secondDerivative ) > 1e-6 ||
+           std::abs( autodiff::derivative< 1 >( dual ) - secondDerivative ) > 1e-6 ) {
+        std::cout << name << ": complex or dual derivative mismatch at x = " << x( k ) << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+
+} // namespace
+
+int main()
+{
+  // monotone data with a plateau
+  const std::vector< double > x = { 0., 0.25, 0.5, 1., 1.5, 2. };
+  const std::vector< double > y = { 0., 1., 1.2, 1.2, 1.8, 3. };
+
+  const TabulatedFunction linear( x, y );
+  const TabulatedFunction cubic( x, y, Interpolation::monotoneCubic, Extrapolation::linear );
+
+  for ( size_t i = 0; i + 1 < x.size(); i++ ) {
+    const double xMid = ( x[i] + x[i + 1] ) / 2;
+    if ( std::abs( linear( x[i] ) - y[i] ) > 1e-15 || std::abs( cubic( x[i] ) - y[i] ) > 1e-15 ||
+         std::abs( linear( xMid ) - ( y[i] + y[i + 1] ) / 2 ) > 1e-15 ) {
+      std::cout << "Interpolation does not reproduce the table in interval " << i << std::endl;
+      return 1;
+    }
+  }
+
+  // monotone, no overshoot on the plateau
+  double previous = cubic( 0. );
+  for ( double xi = 0.; xi <= 2.; xi += 1e-3 ) {
+    const double yi = cubic( xi );
+    if ( yi < previous - 1e-14 || ( xi > 0.5 && xi < 1. && std::abs( yi - 1.2 ) > 1e-14 ) ) {
+      std::cout << "Monotone cubic interpolation is not monotone at x = " << xi << std::endl;
+      return 1;
+    }
+    previous = yi;
+  }
+
+  // constant and linear continuation with the end slope
+  if ( linear( -1. ) != 0. || linear( 3. ) != 3. || std::abs( cubic( 3. ) - 3. - cubic.derivative( 2. ) ) > 1e-14 ) {
+    std::cout << "Extrapolation failed" << std::endl;
+    return 1;
+  }
+
+  // uniform grid with the O( 1 ) lookup matches the non-uniform lookup
+  const std::vector< double > yUniform = { 0., 0.5, 0.8, 1.0, 1.1 };
+  const TabulatedFunction     uniform  = TabulatedFunction::uniform( 0., 0.5, yUniform, Interpolation::monotoneCubic );
+  const TabulatedFunction     general( { 0., 0.5, 1., 1.5, 2. }, yUniform, Interpolation::monotoneCubic );
+  for ( double xi = -0.1; xi <= 2.1; xi += 0.01 )
+    if ( std::abs( uniform( xi ) - general( xi ) ) > 1e-14 ) {
+      std::cout << "Uniform lookup differs at x = " << xi << std::endl;
+      return 1;
+    }
+
+  return checkDerivatives( linear, "linear" ) && checkDerivatives( cubic, "monotone cubic" ) &&
+             checkDerivatives( uniform, "uniform" ) && checkScalarTypesOfDerivative( linear, "linear" ) &&
+             checkScalarTypesOfDerivative( cubic, "monotone cubic" ) &&
+             checkScalarTypesOfDerivative( uniform, "uniform" )
+           ? 0
+           : 1;
+}
@@ -0,0 +1,61 @@
+#include "Marmot/MarmotTangentVerification.h"
+#include <iostream>
+
+using namespace Marmot::NumericalAlgorithms::TangentVerification;
+
+namespace {
+
+  template < typename Vector >
+  Vector residual( const Vector& X )
+  {
+    Vector R( X.size() );
+    for ( Eigen::Index i = 0; i < X.size(); i++ )
+      R( i ) = X( i ) * X( i ) * X( ( i + 1 ) % X.size() ) + exp( X( i ) );
+    return R;
+  }
+
+  Eigen::MatrixXd analyticTangent( const Eigen::VectorXd& X )
+  {
+    const Eigen::Index n = X.size();
+    Eigen::MatrixXd    J = Eigen::MatrixXd::Zero( n, n );
+    for ( Eigen::Index i = 0; i < n; i++ ) {
+      J( i, i ) += 2 * X( i ) * X( ( i + 1 ) % n ) + std::exp( X( i ) );
+      J( i, ( i + 1 ) % n ) += X( i ) * X( i );
+    }
+    return J;
+  }
+
+} // namespace
+
+int main()
+{
+  const Eigen::VectorXd X = Eigen::VectorXd::LinSpaced( 50, -1., 1. );
+  const Eigen::MatrixXd J = analyticTangent( X );
+
+  Eigen::MatrixXd JWrong = J;
+  JWrong( 17, 31 ) += 1e-2;
+
+  const auto F        = []( const Eigen::VectorXd& X_ ) -> Eigen::VectorXd { return residual( X_ ); };
+  const auto FComplex = []( const Eigen::VectorXcd& X_ ) -> Eigen::VectorXcd { return residual( X_ ); };
+
+  StochasticCheckOptions options;
+  options.nProbes = 20;
+
+  const StochasticCheckResult correct        = checkTangent( F, X, J, options );
+  const StochasticCheckResult correctComplex = checkTangentComplexStep( FComplex, X, J, options );
+  const StochasticCheckResult wrong          = checkTangent( F, X, JWrong, options );
+  const StochasticCheckResult wrongComplex   = checkTangentComplexStep( FComplex, X, JWrong, options );
+
+  if ( !correct.passed || !correctComplex.passed || correct.nEvaluations != 40 || correctComplex.nEvaluations != 20 ) {
+    std::cout << "Correct tangent rejected, relative errors " << correct.maximumRelativeError << " and "
+              << correctComplex.maximumRelativeError << std::endl;
+    return 1;
+  }
+
+  if ( wrong.passed || wrongComplex.passed || wrong.missProbability > 1e-6 ) {
+    std::cout << "Wrong tangent accepted" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,180 @@
+#include "Marmot/MarmotTensor.h"
+#include <iostream>
+
+using namespace Marmot;
+using namespace Marmot::ContinuumMechanics::TensorUtility;
+
+namespace {
+
+  bool check( const std::string& name, bool condition )
+  {
+    if ( !condition )
+      std::cout << name << " failed" << std::endl;
+    return condition;
+  }
+
+  // compile time checks of the traits behind checkReinterpretable
+  using RowMajor3d = Eigen::Matrix< double, 3, 3, Eigen::RowMajor >;
+
+  static_assert( CompileTimeSize< Matrix9d >::value == 81 );
+  static_assert( CompileTimeSize< EigenTensors::Tensor3333d >::value == 81 );
+  static_assert( CompileTimeSize< Eigen::MatrixXd >::value == Eigen::Dynamic );
+  static_assert( IsContiguous< Matrix9d >::value );
+  static_assert( IsContiguous< EigenTensors::Tensor3333d >::value );
+  static_assert( IsContiguous< Eigen::Map< Matrix6d > >::value );
+  static_assert( !IsContiguous< Eigen::Map< Matrix6d, 0, Eigen::OuterStride< 8 > > >::value );
+  static_assert( !IsContiguous< Eigen::Map< Matrix6d, 0, Eigen::OuterStride<> > >::value );
+  static_assert( IsColumnMajor< Matrix9d >::value );
+  static_assert( IsColumnMajor< EigenTensors::Tensor3333d >::value );
+  static_assert( !IsColumnMajor< RowMajor3d >::value );
+  static_assert( IsColumnMajor< Eigen::Matrix< double, 1, 9, Eigen::RowMajor > >::value );
+  static_assert( !IsColumnMajor< Eigen::TensorFixedSize< double, Eigen::Sizes< 3, 3 >, Eigen::RowMajor > >::value );
+
+  // mutable objects yield mutable views, const objects read-only views
+  static_assert( std::is_same_v< decltype( as< 9, 9 >( std::declval< EigenTensors::Tensor3333d& >() ) ),
+                                 Eigen::Map< Matrix9d > > );
+  static_assert( std::is_same_v< decltype( as< 9, 9 >( std::declval< const EigenTensors::Tensor3333d& >() ) ),
+                                 Eigen::Map< const Matrix9d > > );
+  static_assert( std::is_same_v< decltype( asTensor< 3, 3, 3, 3 >( std::declval< Matrix9d& >() ) ),
+                                 Eigen::TensorMap< EigenTensors::Tensor3333d > > );
+  static_assert( std::is_same_v< decltype( asTensor< 3, 3, 3, 3 >( std::declval< const Matrix9d& >() ) ),
+                                 Eigen::TensorMap< const EigenTensors::Tensor3333d > > );
+  static_assert( std::is_same_v< decltype( map< 6, 6 >( std::declval< double* >() ) ), Eigen::Map< Matrix6d > > );
+  static_assert(
+    std::is_same_v< decltype( map< 6, 6 >( std::declval< const double* >() ) ), Eigen::Map< const Matrix6d > > );
+  using DynamicStride = Eigen::Stride< Eigen::Dynamic, Eigen::Dynamic >;
+  static_assert( std::is_same_v< decltype( mapStrided< 6, 6 >( std::declval< const double* >(), 8 ) ),
+                                 Eigen::Map< const Matrix6d, Eigen::Unaligned, DynamicStride > > );
+  static_assert( std::is_same_v< decltype( mapTensor< 3, 3, 3, 3 >( std::declval< const double* >() ) ),
+                                 Eigen::TensorMap< const EigenTensors::Tensor3333d > > );
+
+  bool testAs()
+  {
+    bool passed = true;
+
+    EigenTensors::Tensor3333d T;
+    T.setRandom();
+
+    // Tensor3333d as Matrix9d: ( i + 3 j, k + 3 l ) <-> ( i, j, k, l ), aliasing the storage of T
+    auto M = as< 9, 9 >( T );
+    passed &= check( "as: aliasing", M.data() == T.data() );
+
+    bool layout = true;
+    for ( int i = 0; i < 3; i++ )
+      for ( int j = 0; j < 3; j++ )
+        for ( int k = 0; k < 3; k++ )
+          for ( int l = 0; l < 3; l++ )
+            layout &= M( i + 3 * j, k + 3 * l ) == T( i, j, k, l );
+    passed &= check( "as: layout", layout );
+
+    M( 1 + 3 * 2, 0 + 3 * 1 ) = 42.;
+    passed &= check( "as: write through", T( 1, 2, 0, 1 ) == 42. );
+
+    const EigenTensors::Tensor3333d& constT = T;
+    passed &= check( "as: const aliasing", as< 9, 9 >( constT ).data() == T.data() );
+
+    // Matrix9d as Tensor3333d and back
+    Matrix9d A = Matrix9d::Random();
+    auto     t = asTensor< 3, 3, 3, 3 >( A );
+    passed &= check( "asTensor: aliasing", t.data() == A.data() );
+    passed &= check( "asTensor: layout", t( 2, 0, 1, 2 ) == A( 2 + 3 * 0, 1 + 3 * 2 ) );
+
+    t( 0, 1, 2, 1 ) = -7.;
+    passed &= check( "asTensor: write through", A( 0 + 3 * 1, 2 + 3 * 1 ) == -7. );
+
+    const Matrix9d& constA = A;
+    passed &= check( "asTensor: const aliasing", asTensor< 3, 3, 3, 3 >( constA ).data() == A.data() );
+
+    // vectors can be reinterpreted as well
+    Eigen::Matrix< double, 9, 1 > v = Eigen::Matrix< double, 9, 1 >::Random();
+    auto                          m = as< 3, 3 >( v );
+    m( 2, 1 )                       = 3.;
+    passed &= check( "as: vector write through", v( 2 + 3 * 1 ) == 3. );
+
+    // flatten aliases the storage
+    auto flat = flatten( A );
+    flat( 17 ) = 5.;
+    passed &= check( "flatten: write through", A( 17 % 9, 17 / 9 ) == 5. );
+
+    return passed;
+  }
+
+  bool testMap()
+  {
+    bool passed = true;
+
+    // Fortran ordered host code arrays
+    double statev[36];
+    for ( int i = 0; i < 36; i++ )
+      statev[i] = i;
+
+    auto S = map< 6, 6 >( statev );
+    passed &= check( "map: aliasing", S.data() == statev );
+    passed &= check( "map: layout", S( 4, 3 ) == statev[4 + 6 * 3] );
+
+    S( 5, 2 ) = -1.;
+    passed &= check( "map: write through", statev[5 + 6 * 2] == -1. );
+
+    const double* constStatev = statev;
+    passed &= check( "map: const", map< 6, 6 >( constStatev )( 5, 2 ) == -1. );
+
+    // the upper left 6x6 block of a DDSDDE with NTENS = 8
+    constexpr int ntens = 8;
+    double        ddsdde[ntens * ntens];
+    for ( int i = 0; i < ntens * ntens; i++ )
+      ddsdde[i] = i;
+
+    auto C = mapStrided< 6, 6 >( ddsdde, ntens );
+    passed &= check( "mapStrided: aliasing", C.data() == ddsdde );
+    passed &= check( "mapStrided: strides", C.outerStride() == ntens && C.innerStride() == 1 );
+
+    bool layout = true;
+    for ( int i = 0; i < 6; i++ )
+      for ( int j = 0; j < 6; j++ )
+        layout &= C( i, j ) == ddsdde[i + ntens * j];
+    passed &= check( "mapStrided: layout", layout );
+
+    C = Matrix6d::Identity();
+    bool untouched = true;
+    for ( int j = 0; j < ntens; j++ )
+      for ( int i = 0; i < ntens; i++ )
+        if ( i >= 6 || j >= 6 )
+          untouched &= ddsdde[i + ntens * j] == i + ntens * j;
+        else
+          untouched &= ddsdde[i + ntens * j] == ( i == j ? 1. : 0. );
+    passed &= check( "mapStrided: write through", untouched );
+
+    // every second entry, e.g., interleaved storage
+    double interleaved[18];
+    for ( int i = 0; i < 18; i++ )
+      interleaved[i] = i;
+    const double* constInterleaved = interleaved;
+    const auto    v                = mapStrided< 3, 3 >( constInterleaved, 6, 2 );
+    passed &= check( "mapStrided: inner stride", v( 1, 2 ) == interleaved[2 * 1 + 6 * 2] );
+
+    // tensors
+    double data[81];
+    for ( int i = 0; i < 81; i++ )
+      data[i] = i;
+
+    auto T = mapTensor< 3, 3, 3, 3 >( data );
+    passed &= check( "mapTensor: aliasing", T.data() == data );
+    passed &= check( "mapTensor: layout", T( 1, 2, 0, 2 ) == data[1 + 3 * 2 + 9 * 0 + 27 * 2] );
+
+    T( 2, 2, 1, 0 ) = -3.;
+    passed &= check( "mapTensor: write through", data[2 + 3 * 2 + 9 * 1 + 27 * 0] == -3. );
+
+    return passed;
+  }
+
+} // namespace
+
+int main()
+{
+  bool passed = true;
+
+  passed &= testAs();
+  passed &= testMap();
+
+  return passed ? 0 : 1;
+}